@@ -0,0 +1,221 @@
+#include <benchmark/benchmark.h>
+#include <entropy/entropy.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+using NoiseGen = entropy::noise::NoiseGen;
+
+// Every benchmark reports time/sample and samples/s. Sampling patterns:
+//   random - GetNoise(...) on scattered coordinates (cache/branch unfriendly call-per-sample path)
+//   grid   - GenUniformGrid2D/3D over a block of samples (bulk path)
+//   batch  - GetNoiseBatch(...) on the same scattered coordinates as random
+
+namespace {
+
+    const char *kNoiseNames[] = {"OpenSimplex2", "OpenSimplex2S", "Cellular", "Perlin", "ValueCubic", "Value"};
+    const char *kFractalNames[] = {"None", "FBm", "Ridged", "PingPong"};
+    const char *kDistanceNames[] = {"Euclidean", "EuclideanSq", "Manhattan", "Hybrid"};
+    const char *kReturnNames[] = {"CellValue",    "Distance",     "Distance2",   "Distance2Add",
+                                  "Distance2Sub", "Distance2Mul", "Distance2Div"};
+    const char *kWarpNames[] = {"OpenSimplex2", "OpenSimplex2Reduced", "BasicGrid"};
+    const char *kWarpFractalNames[] = {"None", "Progressive", "Independent"};
+    const char *kPatternNames[] = {"random", "grid", "batch"};
+
+    enum Pattern { Pattern_Random, Pattern_Grid, Pattern_Batch };
+
+    const int kSamples2D = 64 * 64;
+    const int kSamples3D = 16 * 16 * 16;
+
+    std::vector<float> random_coords(size_t count, int seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(-10000.0f, 10000.0f);
+        std::vector<float> coords(count);
+        for (auto &c : coords) {
+            c = dist(rng);
+        }
+        return coords;
+    }
+
+    // time/sample is printed in seconds with an SI prefix, e.g. 21.3ns
+    void report(benchmark::State &state, int samples) {
+        state.counters["samples/s"] = benchmark::Counter(samples, benchmark::Counter::kIsIterationInvariantRate);
+        state.counters["time/sample"] =
+            benchmark::Counter(samples, benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    }
+
+    void run_2d(benchmark::State &state, const NoiseGen &gen, Pattern pattern) {
+        std::vector<float> out(kSamples2D);
+
+        if (pattern == Pattern_Grid) {
+            for (auto _ : state) {
+                gen.GenUniformGrid2D(out.data(), 100.0f, -250.0f, 64, 64, 0.75f);
+                benchmark::DoNotOptimize(out.data());
+                benchmark::ClobberMemory();
+            }
+        } else if (pattern == Pattern_Batch) {
+            std::vector<float> xs = random_coords(kSamples2D, 42);
+            std::vector<float> ys = random_coords(kSamples2D, 43);
+            for (auto _ : state) {
+                gen.GetNoiseBatch(xs.data(), ys.data(), out.data(), kSamples2D);
+                benchmark::DoNotOptimize(out.data());
+                benchmark::ClobberMemory();
+            }
+        } else {
+            std::vector<float> coords = random_coords(kSamples2D * 2, 42);
+            for (auto _ : state) {
+                for (int i = 0; i < kSamples2D; ++i) {
+                    out[i] = gen.GetNoise(coords[i * 2], coords[i * 2 + 1]);
+                }
+                benchmark::DoNotOptimize(out.data());
+                benchmark::ClobberMemory();
+            }
+        }
+
+        report(state, kSamples2D);
+    }
+
+    void run_3d(benchmark::State &state, const NoiseGen &gen, Pattern pattern) {
+        std::vector<float> out(kSamples3D);
+
+        if (pattern == Pattern_Grid) {
+            for (auto _ : state) {
+                gen.GenUniformGrid3D(out.data(), 100.0f, -250.0f, 30.0f, 16, 16, 16, 0.75f);
+                benchmark::DoNotOptimize(out.data());
+                benchmark::ClobberMemory();
+            }
+        } else if (pattern == Pattern_Batch) {
+            std::vector<float> xs = random_coords(kSamples3D, 42);
+            std::vector<float> ys = random_coords(kSamples3D, 43);
+            std::vector<float> zs = random_coords(kSamples3D, 44);
+            for (auto _ : state) {
+                gen.GetNoiseBatch(xs.data(), ys.data(), zs.data(), out.data(), kSamples3D);
+                benchmark::DoNotOptimize(out.data());
+                benchmark::ClobberMemory();
+            }
+        } else {
+            std::vector<float> coords = random_coords(kSamples3D * 3, 42);
+            for (auto _ : state) {
+                for (int i = 0; i < kSamples3D; ++i) {
+                    out[i] = gen.GetNoise(coords[i * 3], coords[i * 3 + 1], coords[i * 3 + 2]);
+                }
+                benchmark::DoNotOptimize(out.data());
+                benchmark::ClobberMemory();
+            }
+        }
+
+        report(state, kSamples3D);
+    }
+
+    // Args: noise type, fractal type, pattern
+    NoiseGen noise_gen(const benchmark::State &state) {
+        NoiseGen gen(1337);
+        gen.SetFrequency(0.02f);
+        gen.SetNoiseType(static_cast<NoiseGen::NoiseType>(state.range(0)));
+        gen.SetFractalType(static_cast<NoiseGen::FractalType>(state.range(1)));
+        gen.SetFractalOctaves(4);
+        return gen;
+    }
+
+    void BM_Noise2D(benchmark::State &state) {
+        state.SetLabel(std::string(kNoiseNames[state.range(0)]) + "/" + kFractalNames[state.range(1)] + "/" +
+                       kPatternNames[state.range(2)]);
+        run_2d(state, noise_gen(state), static_cast<Pattern>(state.range(2)));
+    }
+
+    void BM_Noise3D(benchmark::State &state) {
+        state.SetLabel(std::string(kNoiseNames[state.range(0)]) + "/" + kFractalNames[state.range(1)] + "/" +
+                       kPatternNames[state.range(2)]);
+        run_3d(state, noise_gen(state), static_cast<Pattern>(state.range(2)));
+    }
+
+    // Args: distance function, return type, pattern
+    NoiseGen cellular_gen(const benchmark::State &state) {
+        NoiseGen gen(1337);
+        gen.SetFrequency(0.02f);
+        gen.SetNoiseType(NoiseGen::NoiseType_Cellular);
+        gen.SetCellularDistanceFunction(static_cast<NoiseGen::CellularDistanceFunction>(state.range(0)));
+        gen.SetCellularReturnType(static_cast<NoiseGen::CellularReturnType>(state.range(1)));
+        return gen;
+    }
+
+    void BM_Cellular2D(benchmark::State &state) {
+        state.SetLabel(std::string(kDistanceNames[state.range(0)]) + "/" + kReturnNames[state.range(1)] + "/" +
+                       kPatternNames[state.range(2)]);
+        run_2d(state, cellular_gen(state), static_cast<Pattern>(state.range(2)));
+    }
+
+    void BM_Cellular3D(benchmark::State &state) {
+        state.SetLabel(std::string(kDistanceNames[state.range(0)]) + "/" + kReturnNames[state.range(1)] + "/" +
+                       kPatternNames[state.range(2)]);
+        run_3d(state, cellular_gen(state), static_cast<Pattern>(state.range(2)));
+    }
+
+    // Args: domain warp type, warp fractal (none / progressive / independent)
+    NoiseGen warp_gen(const benchmark::State &state) {
+        const NoiseGen::FractalType fractals[] = {NoiseGen::FractalType_None,
+                                                  NoiseGen::FractalType_DomainWarpProgressive,
+                                                  NoiseGen::FractalType_DomainWarpIndependent};
+        NoiseGen gen(1337);
+        gen.SetFrequency(0.02f);
+        gen.SetDomainWarpType(static_cast<NoiseGen::DomainWarpType>(state.range(0)));
+        gen.SetDomainWarpAmp(30.0f);
+        gen.SetFractalType(fractals[state.range(1)]);
+        gen.SetFractalOctaves(3);
+        return gen;
+    }
+
+    void BM_DomainWarp2D(benchmark::State &state) {
+        state.SetLabel(std::string(kWarpNames[state.range(0)]) + "/" + kWarpFractalNames[state.range(1)]);
+        NoiseGen gen = warp_gen(state);
+        std::vector<float> coords = random_coords(kSamples2D * 2, 7);
+        std::vector<float> work(coords.size());
+
+        for (auto _ : state) {
+            work = coords;
+            for (int i = 0; i < kSamples2D; ++i) {
+                gen.DomainWarp(work[i * 2], work[i * 2 + 1]);
+            }
+            benchmark::DoNotOptimize(work.data());
+            benchmark::ClobberMemory();
+        }
+
+        report(state, kSamples2D);
+    }
+
+    void BM_DomainWarp3D(benchmark::State &state) {
+        state.SetLabel(std::string(kWarpNames[state.range(0)]) + "/" + kWarpFractalNames[state.range(1)]);
+        NoiseGen gen = warp_gen(state);
+        std::vector<float> coords = random_coords(kSamples3D * 3, 7);
+        std::vector<float> work(coords.size());
+
+        for (auto _ : state) {
+            work = coords;
+            for (int i = 0; i < kSamples3D; ++i) {
+                gen.DomainWarp(work[i * 3], work[i * 3 + 1], work[i * 3 + 2]);
+            }
+            benchmark::DoNotOptimize(work.data());
+            benchmark::ClobberMemory();
+        }
+
+        report(state, kSamples3D);
+    }
+
+} // namespace
+
+BENCHMARK(BM_Noise2D)
+    ->ArgsProduct({{0, 1, 2, 3, 4, 5}, {0, 1, 2, 3}, {0, 1, 2}})
+    ->ArgNames({"noise", "fractal", "pattern"});
+BENCHMARK(BM_Noise3D)
+    ->ArgsProduct({{0, 1, 2, 3, 4, 5}, {0, 1, 2, 3}, {0, 1, 2}})
+    ->ArgNames({"noise", "fractal", "pattern"});
+BENCHMARK(BM_Cellular2D)
+    ->ArgsProduct({{0, 1, 2, 3}, {0, 1, 2, 3, 4, 5, 6}, {0, 1, 2}})
+    ->ArgNames({"distance", "return", "pattern"});
+BENCHMARK(BM_Cellular3D)
+    ->ArgsProduct({{0, 1, 2, 3}, {0, 1, 2, 3, 4, 5, 6}, {0, 1, 2}})
+    ->ArgNames({"distance", "return", "pattern"});
+BENCHMARK(BM_DomainWarp2D)->ArgsProduct({{0, 1, 2}, {0, 1, 2}})->ArgNames({"warp", "fractal"});
+BENCHMARK(BM_DomainWarp3D)->ArgsProduct({{0, 1, 2}, {0, 1, 2}})->ArgNames({"warp", "fractal"});
+
+BENCHMARK_MAIN();
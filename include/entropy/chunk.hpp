@@ -0,0 +1,301 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "generator.hpp"
+#include "parallel.hpp"
+
+namespace entropy {
+    namespace noise {
+
+        class ChunkCache {
+          public:
+            typedef std::shared_ptr<const std::vector<float>> Chunk;
+
+            ChunkCache(int chunkSize = 64, float step = 1.0f, size_t capacity = 256, size_t threadCount = 1);
+
+            Chunk GetChunk2D(const NoiseGen &noise, int chunkX, int chunkY);
+
+            Chunk GetChunk3D(const NoiseGen &noise, int chunkX, int chunkY, int chunkZ);
+
+            void Prefetch2D(const NoiseGen &noise, int chunkX, int chunkY, int radius);
+
+            void Prefetch3D(const NoiseGen &noise, int chunkX, int chunkY, int chunkZ, int radius);
+
+            bool Contains2D(const NoiseGen &noise, int chunkX, int chunkY) const;
+
+            bool Contains3D(const NoiseGen &noise, int chunkX, int chunkY, int chunkZ) const;
+
+            void SetCapacity(size_t capacity);
+
+            void Clear();
+
+            int GetChunkSize() const;
+
+            float GetStep() const;
+
+            size_t GetCapacity() const;
+
+            size_t GetSize() const;
+
+            size_t GetHits() const;
+
+            size_t GetMisses() const;
+
+          private:
+            struct Key {
+                size_t configHash;
+                int dimensions;
+                int x, y, z;
+
+                bool operator==(const Key &other) const {
+                    return configHash == other.configHash && dimensions == other.dimensions && x == other.x &&
+                           y == other.y && z == other.z;
+                }
+            };
+
+            struct KeyHash {
+                size_t operator()(const Key &key) const {
+                    size_t hash = key.configHash ^ (size_t)key.dimensions;
+                    hash = hash * 0x9E3779B97F4A7C15ull ^ (size_t)(unsigned)key.x;
+                    hash = hash * 0x9E3779B97F4A7C15ull ^ (size_t)(unsigned)key.y;
+                    hash = hash * 0x9E3779B97F4A7C15ull ^ (size_t)(unsigned)key.z;
+                    return hash;
+                }
+            };
+
+            typedef std::list<std::pair<Key, Chunk>> LruList;
+
+            parallel::WorkStealingPool mPool;
+            int mChunkSize;
+            float mStep;
+            size_t mCapacity;
+            size_t mHits = 0;
+            size_t mMisses = 0;
+
+            // Most recently used at the front
+            LruList mLru;
+            std::unordered_map<Key, LruList::iterator, KeyHash> mIndex;
+
+            Chunk Lookup(const Key &key);
+
+            Chunk Generate(const NoiseGen &noise, const Key &key) const;
+
+            void Insert(const Key &key, Chunk chunk);
+
+            void PrefetchKeys(const NoiseGen &noise, const std::vector<Key> &keys);
+        };
+
+        // ============ IMPLEMENTATION ============
+
+        /// <summary>
+        /// Bounded LRU cache of fixed-size noise chunks, keyed by chunk coordinates and NoiseGen::GetConfigHash
+        /// </summary>
+        /// <remarks>
+        /// A chunk holds chunkSize^2 (2D) or chunkSize^3 (3D) samples spaced step apart, chunk (cx, cy) starting at
+        /// (cx * chunkSize * step, cy * chunkSize * step), laid out like GenUniformGrid2D/3D.
+        /// threadCount is used by Prefetch2D/3D to generate missing chunks in parallel (1 = calling thread only,
+        /// 0 = every hardware thread). Not thread-safe: share one cache per thread or guard it externally
+        /// </remarks>
+        inline ChunkCache::ChunkCache(int chunkSize, float step, size_t capacity, size_t threadCount)
+            : mPool(threadCount), mChunkSize(chunkSize > 0 ? chunkSize : 1), mStep(step), mCapacity(capacity) {}
+
+        /// <summary>
+        /// Returns the 2D chunk at (chunkX, chunkY), generating and caching it on a miss
+        /// </summary>
+        /// <remarks>
+        /// Same values as GenUniformGrid2D over the chunk. The returned chunk stays valid after eviction
+        /// </remarks>
+        inline ChunkCache::Chunk ChunkCache::GetChunk2D(const NoiseGen &noise, int chunkX, int chunkY) {
+            Key key = {noise.GetConfigHash(), 2, chunkX, chunkY, 0};
+            if (Chunk chunk = Lookup(key))
+                return chunk;
+
+            Chunk chunk = Generate(noise, key);
+            Insert(key, chunk);
+            return chunk;
+        }
+
+        /// <summary>
+        /// Returns the 3D chunk at (chunkX, chunkY, chunkZ), generating and caching it on a miss
+        /// </summary>
+        /// <remarks>
+        /// Same values as GenUniformGrid3D over the chunk. The returned chunk stays valid after eviction
+        /// </remarks>
+        inline ChunkCache::Chunk ChunkCache::GetChunk3D(const NoiseGen &noise, int chunkX, int chunkY, int chunkZ) {
+            Key key = {noise.GetConfigHash(), 3, chunkX, chunkY, chunkZ};
+            if (Chunk chunk = Lookup(key))
+                return chunk;
+
+            Chunk chunk = Generate(noise, key);
+            Insert(key, chunk);
+            return chunk;
+        }
+
+        /// <summary>
+        /// Generates every missing 2D chunk within radius (Chebyshev distance) of (chunkX, chunkY)
+        /// </summary>
+        /// <remarks>
+        /// Nearest chunks first; stops early rather than evicting chunks it just prefetched when the
+        /// neighbourhood is larger than the capacity. Does not count towards hits or misses
+        /// </remarks>
+        inline void ChunkCache::Prefetch2D(const NoiseGen &noise, int chunkX, int chunkY, int radius) {
+            size_t hash = noise.GetConfigHash();
+            std::vector<Key> keys;
+            for (int ring = 0; ring <= radius; ring++) {
+                for (int y = -ring; y <= ring; y++) {
+                    for (int x = -ring; x <= ring; x++) {
+                        if (x == -ring || x == ring || y == -ring || y == ring)
+                            keys.push_back({hash, 2, chunkX + x, chunkY + y, 0});
+                    }
+                }
+            }
+            PrefetchKeys(noise, keys);
+        }
+
+        /// <summary>
+        /// Generates every missing 3D chunk within radius (Chebyshev distance) of (chunkX, chunkY, chunkZ)
+        /// </summary>
+        /// <remarks>
+        /// Nearest chunks first; stops early rather than evicting chunks it just prefetched when the
+        /// neighbourhood is larger than the capacity. Does not count towards hits or misses
+        /// </remarks>
+        inline void ChunkCache::Prefetch3D(const NoiseGen &noise, int chunkX, int chunkY, int chunkZ, int radius) {
+            size_t hash = noise.GetConfigHash();
+            std::vector<Key> keys;
+            for (int ring = 0; ring <= radius; ring++) {
+                for (int z = -ring; z <= ring; z++) {
+                    for (int y = -ring; y <= ring; y++) {
+                        for (int x = -ring; x <= ring; x++) {
+                            if (x == -ring || x == ring || y == -ring || y == ring || z == -ring || z == ring)
+                                keys.push_back({hash, 3, chunkX + x, chunkY + y, chunkZ + z});
+                        }
+                    }
+                }
+            }
+            PrefetchKeys(noise, keys);
+        }
+
+        /// <summary>
+        /// True if the 2D chunk is cached for this noise configuration (does not touch LRU order)
+        /// </summary>
+        inline bool ChunkCache::Contains2D(const NoiseGen &noise, int chunkX, int chunkY) const {
+            return mIndex.count({noise.GetConfigHash(), 2, chunkX, chunkY, 0}) != 0;
+        }
+
+        /// <summary>
+        /// True if the 3D chunk is cached for this noise configuration (does not touch LRU order)
+        /// </summary>
+        inline bool ChunkCache::Contains3D(const NoiseGen &noise, int chunkX, int chunkY, int chunkZ) const {
+            return mIndex.count({noise.GetConfigHash(), 3, chunkX, chunkY, chunkZ}) != 0;
+        }
+
+        /// <summary>
+        /// Sets the maximum number of cached chunks, evicting the least recently used ones if needed
+        /// </summary>
+        inline void ChunkCache::SetCapacity(size_t capacity) {
+            mCapacity = capacity;
+            while (mLru.size() > mCapacity) {
+                mIndex.erase(mLru.back().first);
+                mLru.pop_back();
+            }
+        }
+
+        /// <summary>
+        /// Drops every cached chunk and resets the hit/miss counters
+        /// </summary>
+        inline void ChunkCache::Clear() {
+            mLru.clear();
+            mIndex.clear();
+            mHits = 0;
+            mMisses = 0;
+        }
+
+        inline int ChunkCache::GetChunkSize() const { return mChunkSize; }
+
+        inline float ChunkCache::GetStep() const { return mStep; }
+
+        inline size_t ChunkCache::GetCapacity() const { return mCapacity; }
+
+        inline size_t ChunkCache::GetSize() const { return mLru.size(); }
+
+        /// <summary>
+        /// Number of GetChunk2D/3D calls served from the cache
+        /// </summary>
+        inline size_t ChunkCache::GetHits() const { return mHits; }
+
+        /// <summary>
+        /// Number of GetChunk2D/3D calls that had to generate their chunk
+        /// </summary>
+        inline size_t ChunkCache::GetMisses() const { return mMisses; }
+
+        inline ChunkCache::Chunk ChunkCache::Lookup(const Key &key) {
+            auto found = mIndex.find(key);
+            if (found == mIndex.end()) {
+                mMisses++;
+                return nullptr;
+            }
+
+            mHits++;
+            mLru.splice(mLru.begin(), mLru, found->second);
+            return found->second->second;
+        }
+
+        inline ChunkCache::Chunk ChunkCache::Generate(const NoiseGen &noise, const Key &key) const {
+            float span = mChunkSize * mStep;
+
+            if (key.dimensions == 2) {
+                auto chunk = std::make_shared<std::vector<float>>((size_t)mChunkSize * mChunkSize);
+                noise.GenUniformGrid2D(chunk->data(), key.x * span, key.y * span, mChunkSize, mChunkSize, mStep);
+                return chunk;
+            }
+
+            auto chunk = std::make_shared<std::vector<float>>((size_t)mChunkSize * mChunkSize * mChunkSize);
+            noise.GenUniformGrid3D(chunk->data(), key.x * span, key.y * span, key.z * span, mChunkSize, mChunkSize,
+                                   mChunkSize, mStep);
+            return chunk;
+        }
+
+        inline void ChunkCache::Insert(const Key &key, Chunk chunk) {
+            if (mCapacity == 0)
+                return;
+
+            mLru.emplace_front(key, std::move(chunk));
+            mIndex[key] = mLru.begin();
+
+            if (mLru.size() > mCapacity) {
+                mIndex.erase(mLru.back().first);
+                mLru.pop_back();
+            }
+        }
+
+        inline void ChunkCache::PrefetchKeys(const NoiseGen &noise, const std::vector<Key> &keys) {
+            size_t count = keys.size() < mCapacity ? keys.size() : mCapacity;
+
+            std::vector<Key> missing;
+            for (size_t i = 0; i < count; i++) {
+                if (!mIndex.count(keys[i]))
+                    missing.push_back(keys[i]);
+            }
+
+            std::vector<Chunk> chunks(missing.size());
+            mPool.parallel_for(missing.size(), [&](size_t i) { chunks[i] = Generate(noise, missing[i]); });
+
+            // Move every cached chunk in range to the front before inserting anything, so the evictions
+            // below only ever drop chunks outside the neighbourhood. Farthest first in both passes so the
+            // nearest chunks end up most recently used
+            for (size_t i = count; i-- > 0;) {
+                auto found = mIndex.find(keys[i]);
+                if (found != mIndex.end())
+                    mLru.splice(mLru.begin(), mLru, found->second);
+            }
+            for (size_t i = missing.size(); i-- > 0;)
+                Insert(missing[i], std::move(chunks[i]));
+        }
+
+    } // namespace noise
+} // namespace entropy
@@ -1,4 +1,9 @@
 #pragma once
 
+#include "chunk.hpp"
 #include "generator.hpp"
+#include "grid.hpp"
+#include "occupancy.hpp"
 #include "path.hpp"
+#include "static_noise.hpp"
+#include "walk_index.hpp"
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+
+#include "generator.hpp"
+#include "parallel.hpp"
+
+namespace entropy {
+    namespace noise {
+
+        class ParallelGrid {
+          public:
+            ParallelGrid(size_t threadCount = 0);
+
+            void SetTileSize(int xSize, int ySize, int zSize);
+
+            void GenUniformGrid2D(const NoiseGen &noise, float *noiseOut, float xStart, float yStart, int xSize,
+                                  int ySize, float step);
+
+            void GenUniformGrid3D(const NoiseGen &noise, float *noiseOut, float xStart, float yStart, float zStart,
+                                  int xSize, int ySize, int zSize, float step);
+
+            size_t GetThreadCount() const;
+
+          private:
+            parallel::WorkStealingPool mPool;
+            int mTileX = 256;
+            int mTileY = 32;
+            int mTileZ = 8;
+        };
+
+        // ============ IMPLEMENTATION ============
+
+        /// <summary>
+        /// Tiled multithreaded grid generation on a work-stealing pool
+        /// </summary>
+        /// <remarks>
+        /// threadCount includes the calling thread, 0 uses every hardware thread
+        /// </remarks>
+        inline ParallelGrid::ParallelGrid(size_t threadCount) : mPool(threadCount) {}
+
+        /// <summary>
+        /// Sets the tile extent each task fills, default 256 x 32 (2D) and 256 x 32 x 8 (3D)
+        /// </summary>
+        /// <remarks>
+        /// Only affects scheduling, output is the same for any tile size. Non-positive sizes are clamped to 1
+        /// </remarks>
+        inline void ParallelGrid::SetTileSize(int xSize, int ySize, int zSize) {
+            mTileX = xSize > 0 ? xSize : 1;
+            mTileY = ySize > 0 ? ySize : 1;
+            mTileZ = zSize > 0 ? zSize : 1;
+        }
+
+        /// <summary>
+        /// Number of threads sharing the tiles, including the caller
+        /// </summary>
+        inline size_t ParallelGrid::GetThreadCount() const { return mPool.num_threads(); }
+
+        /// <summary>
+        /// Multithreaded NoiseGen::GenUniformGrid2D, same layout and bit-identical output for any thread count
+        /// </summary>
+        inline void ParallelGrid::GenUniformGrid2D(const NoiseGen &noise, float *noiseOut, float xStart, float yStart,
+                                                   int xSize, int ySize, float step) {
+            if (xSize <= 0 || ySize <= 0)
+                return;
+
+            int tilesX = (xSize + mTileX - 1) / mTileX;
+            int tilesY = (ySize + mTileY - 1) / mTileY;
+            int tileX = mTileX;
+            int tileY = mTileY;
+
+            mPool.parallel_for((size_t)tilesX * tilesY, [&](size_t tile) {
+                int xBegin = (int)(tile % tilesX) * tileX;
+                int yBegin = (int)(tile / tilesX) * tileY;
+                int xEnd = xSize - xBegin < tileX ? xSize : xBegin + tileX;
+                int yEnd = ySize - yBegin < tileY ? ySize : yBegin + tileY;
+
+                noise.GenGridRegion2D(noiseOut, xStart, yStart, xSize, step, xBegin, xEnd, yBegin, yEnd);
+            });
+        }
+
+        /// <summary>
+        /// Multithreaded NoiseGen::GenUniformGrid3D, same layout and bit-identical output for any thread count
+        /// </summary>
+        inline void ParallelGrid::GenUniformGrid3D(const NoiseGen &noise, float *noiseOut, float xStart, float yStart,
+                                                   float zStart, int xSize, int ySize, int zSize, float step) {
+            if (xSize <= 0 || ySize <= 0 || zSize <= 0)
+                return;
+
+            int tilesX = (xSize + mTileX - 1) / mTileX;
+            int tilesY = (ySize + mTileY - 1) / mTileY;
+            int tilesZ = (zSize + mTileZ - 1) / mTileZ;
+            int tileX = mTileX;
+            int tileY = mTileY;
+            int tileZ = mTileZ;
+
+            mPool.parallel_for((size_t)tilesX * tilesY * tilesZ, [&](size_t tile) {
+                int xBegin = (int)(tile % tilesX) * tileX;
+                int yBegin = (int)(tile / tilesX % tilesY) * tileY;
+                int zBegin = (int)(tile / ((size_t)tilesX * tilesY)) * tileZ;
+                int xEnd = xSize - xBegin < tileX ? xSize : xBegin + tileX;
+                int yEnd = ySize - yBegin < tileY ? ySize : yBegin + tileY;
+                int zEnd = zSize - zBegin < tileZ ? zSize : zBegin + tileZ;
+
+                noise.GenGridRegion3D(noiseOut, xStart, yStart, zStart, xSize, ySize, step, xBegin, xEnd, yBegin,
+                                      yEnd, zBegin, zEnd);
+            });
+        }
+
+    } // namespace noise
+} // namespace entropy
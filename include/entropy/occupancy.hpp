@@ -0,0 +1,159 @@
+// Visit-count grid for random walks
+// Bins world-space points into a fixed rectangle of equally sized cells
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <datapod/datapod.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace entropy {
+    namespace path {
+
+        class OccupancyGrid {
+          public:
+            // Covers [min_x, max_x) x [min_y, max_y) with width x height cells
+            OccupancyGrid(double min_x, double min_y, double max_x, double max_y, size_t width, size_t height);
+
+            // Count a visit; points outside the grid only increment outside()
+            void add(double x, double y);
+            void add(const datapod::Point &point);
+
+            // Add another grid's counts; the layouts must match
+            void merge(const OccupancyGrid &other);
+
+            // Reset every count to zero
+            void clear();
+
+            // Cell containing (x, y); false if outside the grid
+            bool cell_of(double x, double y, size_t &col, size_t &row) const;
+
+            // Visits of a cell, row 0 at min_y
+            uint32_t at(size_t col, size_t row) const;
+
+            // Row-major counts, width() * height() cells
+            const std::vector<uint32_t> &counts() const;
+
+            // Visits inside and outside the grid
+            uint64_t total() const;
+            uint64_t outside() const;
+
+            size_t width() const;
+            size_t height() const;
+            double min_x() const;
+            double min_y() const;
+            double max_x() const;
+            double max_y() const;
+            double cell_width() const;
+            double cell_height() const;
+
+            // True if other covers the same rectangle with the same cells
+            bool same_layout(const OccupancyGrid &other) const;
+
+          private:
+            double min_x_, min_y_, max_x_, max_y_;
+            size_t width_, height_;
+            double inv_cell_x_, inv_cell_y_;
+            std::vector<uint32_t> counts_;
+            uint64_t total_ = 0;
+            uint64_t outside_ = 0;
+        };
+
+        // ============ IMPLEMENTATION ============
+
+        inline OccupancyGrid::OccupancyGrid(double min_x, double min_y, double max_x, double max_y, size_t width,
+                                            size_t height)
+            : min_x_(min_x), min_y_(min_y), max_x_(max_x), max_y_(max_y), width_(width), height_(height) {
+            if (width == 0 || height == 0) {
+                throw std::invalid_argument("occupancy grid needs at least one cell");
+            }
+            if (!(max_x > min_x) || !(max_y > min_y)) {
+                throw std::invalid_argument("occupancy grid bounds are empty");
+            }
+
+            inv_cell_x_ = static_cast<double>(width) / (max_x - min_x);
+            inv_cell_y_ = static_cast<double>(height) / (max_y - min_y);
+            counts_.assign(width * height, 0);
+        }
+
+        inline void OccupancyGrid::add(double x, double y) {
+            size_t col, row;
+            if (cell_of(x, y, col, row)) {
+                ++counts_[row * width_ + col];
+                ++total_;
+            } else {
+                ++outside_;
+            }
+        }
+
+        inline void OccupancyGrid::add(const datapod::Point &point) { add(point.x, point.y); }
+
+        inline void OccupancyGrid::merge(const OccupancyGrid &other) {
+            if (!same_layout(other)) {
+                throw std::invalid_argument("occupancy grid layouts differ");
+            }
+            for (size_t i = 0; i < counts_.size(); ++i) {
+                counts_[i] += other.counts_[i];
+            }
+            total_ += other.total_;
+            outside_ += other.outside_;
+        }
+
+        inline void OccupancyGrid::clear() {
+            std::fill(counts_.begin(), counts_.end(), 0);
+            total_ = 0;
+            outside_ = 0;
+        }
+
+        inline bool OccupancyGrid::cell_of(double x, double y, size_t &col, size_t &row) const {
+            double fx = std::floor((x - min_x_) * inv_cell_x_);
+            double fy = std::floor((y - min_y_) * inv_cell_y_);
+            // Also rejects NaN
+            if (!(fx >= 0.0 && fx < static_cast<double>(width_) && fy >= 0.0 && fy < static_cast<double>(height_))) {
+                return false;
+            }
+            col = static_cast<size_t>(fx);
+            row = static_cast<size_t>(fy);
+            return true;
+        }
+
+        inline uint32_t OccupancyGrid::at(size_t col, size_t row) const {
+            if (col >= width_ || row >= height_) {
+                throw std::out_of_range("occupancy cell out of range");
+            }
+            return counts_[row * width_ + col];
+        }
+
+        inline const std::vector<uint32_t> &OccupancyGrid::counts() const { return counts_; }
+
+        inline uint64_t OccupancyGrid::total() const { return total_; }
+
+        inline uint64_t OccupancyGrid::outside() const { return outside_; }
+
+        inline size_t OccupancyGrid::width() const { return width_; }
+
+        inline size_t OccupancyGrid::height() const { return height_; }
+
+        inline double OccupancyGrid::min_x() const { return min_x_; }
+
+        inline double OccupancyGrid::min_y() const { return min_y_; }
+
+        inline double OccupancyGrid::max_x() const { return max_x_; }
+
+        inline double OccupancyGrid::max_y() const { return max_y_; }
+
+        inline double OccupancyGrid::cell_width() const { return (max_x_ - min_x_) / static_cast<double>(width_); }
+
+        inline double OccupancyGrid::cell_height() const { return (max_y_ - min_y_) / static_cast<double>(height_); }
+
+        inline bool OccupancyGrid::same_layout(const OccupancyGrid &other) const {
+            return min_x_ == other.min_x_ && min_y_ == other.min_y_ && max_x_ == other.max_x_ &&
+                   max_y_ == other.max_y_ && width_ == other.width_ && height_ == other.height_;
+        }
+
+    } // namespace path
+} // namespace entropy
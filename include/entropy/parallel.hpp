@@ -0,0 +1,201 @@
+// Work-stealing thread pool
+// Each worker owns a deque of task indices, pops from its own front and steals from the back of others
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace entropy {
+    namespace parallel {
+
+        class WorkStealingPool {
+          public:
+            // num_threads includes the calling thread; 0 uses std::thread::hardware_concurrency()
+            explicit WorkStealingPool(size_t num_threads = 0);
+            ~WorkStealingPool();
+
+            WorkStealingPool(const WorkStealingPool &) = delete;
+            WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+            // Runs task(i) for every i in [0, count) and blocks until all are done.
+            // Indices start as contiguous ranges per thread; idle threads steal from busy ones.
+            // The first exception thrown by a task is rethrown here once the batch has drained.
+            // Calls are serialized; calling parallel_for from inside a task is not supported.
+            void parallel_for(size_t count, const std::function<void(size_t)> &task);
+
+            // Total threads taking part in parallel_for, including the caller
+            size_t num_threads() const;
+
+          private:
+            struct Queue {
+                std::mutex mutex;
+                std::deque<size_t> items;
+            };
+
+            std::vector<std::unique_ptr<Queue>> queues_;
+            std::vector<std::thread> workers_;
+
+            std::mutex job_mutex_; // serializes parallel_for callers
+            std::mutex state_mutex_;
+            std::condition_variable wake_;
+            std::condition_variable done_;
+            size_t generation_ = 0;
+            bool stop_ = false;
+
+            const std::function<void(size_t)> *task_ = nullptr;
+            std::atomic<size_t> remaining_{0};
+            std::exception_ptr error_;
+
+            void worker_loop(size_t self);
+            void run_tasks(size_t self);
+            bool pop_local(size_t self, size_t &index);
+            bool steal(size_t self, size_t &index);
+        };
+
+        // ============ IMPLEMENTATION ============
+
+        inline WorkStealingPool::WorkStealingPool(size_t num_threads) {
+            if (num_threads == 0) {
+                num_threads = std::thread::hardware_concurrency();
+                if (num_threads == 0) {
+                    num_threads = 1;
+                }
+            }
+
+            for (size_t i = 0; i < num_threads; ++i) {
+                queues_.push_back(std::make_unique<Queue>());
+            }
+
+            // Queue 0 belongs to the thread calling parallel_for
+            for (size_t i = 1; i < num_threads; ++i) {
+                workers_.emplace_back(&WorkStealingPool::worker_loop, this, i);
+            }
+        }
+
+        inline WorkStealingPool::~WorkStealingPool() {
+            {
+                std::lock_guard<std::mutex> lock(state_mutex_);
+                stop_ = true;
+            }
+            wake_.notify_all();
+            for (auto &worker : workers_) {
+                worker.join();
+            }
+        }
+
+        inline size_t WorkStealingPool::num_threads() const { return queues_.size(); }
+
+        inline void WorkStealingPool::parallel_for(size_t count, const std::function<void(size_t)> &task) {
+            if (count == 0) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> job_lock(job_mutex_);
+
+            if (workers_.empty()) {
+                for (size_t i = 0; i < count; ++i) {
+                    task(i);
+                }
+                return;
+            }
+
+            task_ = &task;
+            error_ = nullptr;
+            remaining_.store(count, std::memory_order_relaxed);
+
+            size_t n = queues_.size();
+            for (size_t q = 0; q < n; ++q) {
+                std::lock_guard<std::mutex> lock(queues_[q]->mutex);
+                for (size_t i = q * count / n; i < (q + 1) * count / n; ++i) {
+                    queues_[q]->items.push_back(i);
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(state_mutex_);
+                ++generation_;
+            }
+            wake_.notify_all();
+
+            run_tasks(0);
+
+            std::unique_lock<std::mutex> lock(state_mutex_);
+            done_.wait(lock, [this] { return remaining_.load(std::memory_order_acquire) == 0; });
+            task_ = nullptr;
+
+            if (error_) {
+                std::rethrow_exception(error_);
+            }
+        }
+
+        inline void WorkStealingPool::worker_loop(size_t self) {
+            size_t seen = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(state_mutex_);
+                    wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                    if (stop_) {
+                        return;
+                    }
+                    seen = generation_;
+                }
+                run_tasks(self);
+            }
+        }
+
+        inline void WorkStealingPool::run_tasks(size_t self) {
+            size_t index;
+            while (pop_local(self, index) || steal(self, index)) {
+                // Indices are only queued while task_ is set, so it is valid for any popped index
+                try {
+                    (*task_)(index);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(state_mutex_);
+                    if (!error_) {
+                        error_ = std::current_exception();
+                    }
+                }
+
+                if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    std::lock_guard<std::mutex> lock(state_mutex_);
+                    done_.notify_all();
+                }
+            }
+        }
+
+        inline bool WorkStealingPool::pop_local(size_t self, size_t &index) {
+            Queue &queue = *queues_[self];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.items.empty()) {
+                return false;
+            }
+            index = queue.items.front();
+            queue.items.pop_front();
+            return true;
+        }
+
+        inline bool WorkStealingPool::steal(size_t self, size_t &index) {
+            size_t n = queues_.size();
+            for (size_t offset = 1; offset < n; ++offset) {
+                Queue &victim = *queues_[(self + offset) % n];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.items.empty()) {
+                    index = victim.items.back();
+                    victim.items.pop_back();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    } // namespace parallel
+} // namespace entropy
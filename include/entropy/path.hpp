@@ -3,10 +3,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <datapod/datapod.hpp>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <random>
 
+#include "occupancy.hpp"
+#include "parallel.hpp"
+
 namespace entropy {
     namespace path {
 
@@ -22,6 +32,12 @@ namespace entropy {
         // Walker type based on speed
         enum class WalkerType { Slow, Normal, Fast, Superhuman };
 
+        // Random number generator driving the walk
+        enum class WalkRng {
+            MT19937,   // sequential std::mt19937 stream, step n needs steps 1..n-1 drawn first
+            SplitMix64 // counter-based, start point and step n are pure functions of (seed, n)
+        };
+
         // Configuration for random walk generation
         struct WalkConfig {
             int seed = 1337;
@@ -30,27 +46,107 @@ namespace entropy {
             MovePattern move_pattern = MovePattern::Moore;
             bool random_start = true;
             double start_range_factor = 1.0; // multiplied by sqrt(steps) for start range
+            // Draw directions in batches from 64-bit RNG words (3 bits per Moore step, 2 per Neumann step)
+            // instead of one distribution call per step. Much faster for long walks, but a different walk
+            // for the same seed than the default per-step draws
+            bool bulk_directions = false;
+            // SplitMix64 always draws directions in batches, so bulk_directions only affects MT19937.
+            // The walker speed is drawn from std::mt19937 either way
+            WalkRng rng = WalkRng::MT19937;
 
             WalkConfig() = default;
             WalkConfig(int seed_) : seed(seed_) {}
         };
 
+        // A run of consecutive walk points handed to a streaming visitor.
+        // The arrays are only valid during the call
+        struct WalkBlock {
+            size_t first = 0;                   // index of the first point (0 = start point)
+            size_t count = 0;                   // points in this block
+            const int32_t *lattice_x = nullptr; // offsets from start, in units of speed
+            const int32_t *lattice_y = nullptr;
+            datapod::Point start;
+            double speed = 0.0;
+
+            // Point i in [0, count)
+            datapod::Point point(size_t i) const {
+                return datapod::Point{start.x + speed * lattice_x[i], start.y + speed * lattice_y[i], start.z};
+            }
+        };
+
+        using WalkVisitor = std::function<void(const WalkBlock &)>;
+
+        // Running statistics of a walk, collected without storing it
+        struct WalkStats {
+            size_t num_points = 0;
+            datapod::Point start;
+            datapod::Point end;
+            double min_x = std::numeric_limits<double>::max();
+            double max_x = std::numeric_limits<double>::lowest();
+            double min_y = std::numeric_limits<double>::max();
+            double max_y = std::numeric_limits<double>::lowest();
+            double mean_squared_displacement = 0.0; // mean of |p - start|^2 over every point after the start
+
+            // End-to-start distance squared
+            double squared_displacement() const {
+                double dx = end.x - start.x, dy = end.y - start.y;
+                return dx * dx + dy * dy;
+            }
+
+            // Bounding box in the same form as WalkSimulation::get_bounds()
+            datapod::Box bounds() const {
+                datapod::Pose center{datapod::Point{(min_x + max_x) / 2.0, (min_y + max_y) / 2.0, 0.0},
+                                     datapod::Quaternion{}};
+                return datapod::Box{center, datapod::Size{max_x - min_x, max_y - min_y, 0.0}};
+            }
+        };
+
         // Random Walk Generator class
         class RandomWalk {
           public:
             RandomWalk(int total_steps, const WalkConfig &config = WalkConfig());
             RandomWalk(int total_steps, int seed);
 
-            // Generate the random walk path
+            // Generate the random walk path. With WalkRng::SplitMix64 and set_num_threads() > 1 the steps are
+            // split into chunks generated in parallel and stitched with a prefix sum of their offsets
             void generate();
 
-            // Get the generated path
+            // Run the same walk generate() would, without storing it: points are passed to visitor in blocks of
+            // up to block_size (if set) and folded into the returned statistics, in constant memory.
+            // Draws from a copy of the RNG, so neither the stored walk nor the next generate() is affected
+            WalkStats stream(const WalkVisitor &visitor = nullptr, size_t block_size = 4096) const;
+
+            // Threads used by generate() for WalkRng::SplitMix64 walks, including the caller.
+            // 1 (default) runs serially, 0 uses std::thread::hardware_concurrency()
+            void set_num_threads(size_t num_threads);
+            size_t get_num_threads() const;
+
+            // Point after step in [0, total_steps]. Reads the stored walk after generate(); otherwise
+            // WalkRng::SplitMix64 walks replay steps 1..step in constant memory and MT19937 walks throw
+            datapod::Point position_at(size_t step) const;
+
+            // Get the generated path. Built from the compact lattice storage on first call and cached
+            // until the next generate(); safe to call from several threads at once
             const datapod::Path &get_path() const;
-            datapod::Path &get_path();
+
+            // Number of generated points (total_steps + 1 after generate(), 0 before)
+            size_t num_points() const;
+
+            // Point at index in [0, num_points()), without materializing the path
+            datapod::Point get_point(size_t index) const;
+
+            // Count every generated point in grid
+            void add_to(OccupancyGrid &grid) const;
+
+            // Compact walk storage: integer lattice offsets of every point from the start point,
+            // in units of the walker speed, so point i = start + speed * (lattice_x[i], lattice_y[i])
+            const std::vector<int32_t> &get_lattice_x() const;
+            const std::vector<int32_t> &get_lattice_y() const;
 
             // Get walker properties
             double get_speed() const;
             WalkerType get_walker_type() const;
+            // Before generate() these are only known for WalkRng::SplitMix64 walks (see position_at)
             datapod::Point get_start_point() const;
             datapod::Point get_end_point() const;
 
@@ -68,17 +164,51 @@ namespace entropy {
             static const char *walker_type_name(WalkerType type);
 
           private:
+            // Path materialized on demand by get_path(). Copies start empty and rebuild it when asked
+            struct PathCache {
+                std::mutex mutex;
+                bool built = false;
+                datapod::Path path;
+
+                PathCache() = default;
+                PathCache(const PathCache &) {}
+                PathCache &operator=(const PathCache &) {
+                    built = false;
+                    path.waypoints.clear();
+                    return *this;
+                }
+            };
+
             int total_steps_;
             WalkConfig config_;
             double walker_speed_;
-            datapod::Path path_;
+            datapod::Point start_;
+            std::vector<int32_t> lattice_x_;
+            std::vector<int32_t> lattice_y_;
+            mutable PathCache path_;
             std::mt19937 rng_;
+            std::shared_ptr<parallel::WorkStealingPool> pool_; // null runs serially, shared by copies
+
+            // Lattice step per Direction
+            static constexpr int32_t kStepX[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+            static constexpr int32_t kStepY[8] = {1, 1, 0, -1, -1, -1, 0, 1};
 
             void init_speed();
             double get_random_speed();
-            datapod::Point get_random_startpoint();
-            Direction get_random_direction();
-            void plan_next_step(Direction direction, const datapod::Point &current);
+            datapod::Point get_random_startpoint(std::mt19937 &rng) const;
+            Direction get_random_direction(std::mt19937 &rng) const;
+            datapod::Point draw_startpoint(std::mt19937 &rng) const;
+            template <typename F> void draw_directions(std::mt19937 &rng, F &&visit) const;
+            template <int Bits, int Scale, typename F> void draw_bulk_directions(std::mt19937 &rng, F &&visit) const;
+
+            // Counter-based stream: word index of stream for the current seed
+            static uint64_t splitmix64(uint64_t z);
+            uint64_t counter_word(uint64_t stream, uint64_t index) const;
+            datapod::Point counter_startpoint() const;
+            template <typename F> void visit_counter_steps(size_t first, size_t last, F &&visit) const;
+            template <int Bits, int Scale, typename F>
+            void visit_counter_steps(size_t first, size_t last, F &&visit) const;
+            void generate_chunks();
         };
 
         // Multi-walker simulation
@@ -86,9 +216,24 @@ namespace entropy {
           public:
             WalkSimulation(int total_steps, int num_walkers, const WalkConfig &config = WalkConfig());
 
-            // Generate all walks
+            // Generate all walks, spread over the thread pool when set_num_threads() > 1.
+            // Every walker owns its seed and RNG, so the result is identical for any thread count.
             void generate();
 
+            // Threads used by generate() and get_bounds(), including the caller.
+            // 1 (default) runs serially, 0 uses std::thread::hardware_concurrency()
+            void set_num_threads(size_t num_threads);
+            size_t get_num_threads() const;
+
+            // Generate all walks and count every point of every walker in grid, on top of its current counts.
+            // Each thread bins into its own copy of the grid while its walkers are generated, and the copies
+            // are merged at the end
+            void generate(OccupancyGrid &grid);
+
+            // Count the walks generate() would produce in grid, streaming them through RandomWalk::stream()
+            // without storing any walker's path
+            void stream(OccupancyGrid &grid, size_t block_size = 4096) const;
+
             // Get all generated paths
             const std::vector<RandomWalk> &get_walkers() const;
             std::vector<RandomWalk> &get_walkers();
@@ -108,6 +253,10 @@ namespace entropy {
             int num_walkers_;
             WalkConfig config_;
             std::vector<RandomWalk> walkers_;
+            std::shared_ptr<parallel::WorkStealingPool> pool_; // null runs serially, shared by copies
+
+            void for_each_walker(const std::function<void(size_t)> &task) const;
+            void for_each_walker(OccupancyGrid &grid, const std::function<void(size_t, OccupancyGrid &)> &task) const;
         };
 
         // ============ IMPLEMENTATION ============
@@ -133,87 +282,337 @@ namespace entropy {
             return dist(rng_);
         }
 
-        inline datapod::Point RandomWalk::get_random_startpoint() {
+        inline datapod::Point RandomWalk::get_random_startpoint(std::mt19937 &rng) const {
             double range = std::sqrt(static_cast<double>(total_steps_)) * config_.start_range_factor;
             std::uniform_real_distribution<double> dist(-range, range);
-            return datapod::Point{dist(rng_), dist(rng_), 0.0};
+            return datapod::Point{dist(rng), dist(rng), 0.0};
         }
 
-        inline Direction RandomWalk::get_random_direction() {
+        inline Direction RandomWalk::get_random_direction(std::mt19937 &rng) const {
             if (config_.move_pattern == MovePattern::Moore) {
                 // 8 directions
                 std::uniform_int_distribution<int> dist(0, 7);
-                return static_cast<Direction>(dist(rng_));
+                return static_cast<Direction>(dist(rng));
             } else {
                 // 4 directions (Neumann): N, E, S, W (indices 0, 2, 4, 6)
                 std::uniform_int_distribution<int> dist(0, 3);
                 int directions[] = {0, 2, 4, 6}; // North, East, South, West
-                return static_cast<Direction>(directions[dist(rng_)]);
-            }
-        }
-
-        inline void RandomWalk::plan_next_step(Direction direction, const datapod::Point &current) {
-            double dx = 0.0, dy = 0.0;
-
-            switch (direction) {
-            case Direction::North:
-                dy = walker_speed_;
-                break;
-            case Direction::Northeast:
-                dx = walker_speed_;
-                dy = walker_speed_;
-                break;
-            case Direction::East:
-                dx = walker_speed_;
-                break;
-            case Direction::Southeast:
-                dx = walker_speed_;
-                dy = -walker_speed_;
-                break;
-            case Direction::South:
-                dy = -walker_speed_;
-                break;
-            case Direction::Southwest:
-                dx = -walker_speed_;
-                dy = -walker_speed_;
-                break;
-            case Direction::West:
-                dx = -walker_speed_;
-                break;
-            case Direction::Northwest:
-                dx = -walker_speed_;
-                dy = walker_speed_;
-                break;
-            }
-
-            datapod::Point new_point{current.x + dx, current.y + dy, current.z};
-            path_.waypoints.push_back(datapod::Pose{new_point, datapod::Quaternion{}});
+                return static_cast<Direction>(directions[dist(rng)]);
+            }
         }
 
         inline void RandomWalk::generate() {
-            path_.waypoints.clear();
+            lattice_x_.clear();
+            lattice_y_.clear();
+            path_.built = false;
+            path_.path.waypoints.clear();
+
+            start_ = draw_startpoint(rng_);
+
+            // Starting point sits at the lattice origin
+            size_t count = static_cast<size_t>(total_steps_) + 1;
+            lattice_x_.resize(count);
+            lattice_y_.resize(count);
+            lattice_x_[0] = 0;
+            lattice_y_[0] = 0;
+
+            if (config_.rng == WalkRng::SplitMix64 && pool_) {
+                generate_chunks();
+                return;
+            }
+
+            // Running sum of the step deltas
+            int32_t *xs = lattice_x_.data();
+            int32_t *ys = lattice_y_.data();
+            int32_t x = 0, y = 0;
+            draw_directions(rng_, [&](size_t step, int dir) {
+                x += kStepX[dir];
+                y += kStepY[dir];
+                xs[step] = x;
+                ys[step] = y;
+            });
+        }
+
+        inline WalkStats RandomWalk::stream(const WalkVisitor &visitor, size_t block_size) const {
+            if (block_size == 0) {
+                block_size = 1;
+            }
+
+            std::mt19937 rng = rng_;
+            WalkStats stats;
+            stats.start = draw_startpoint(rng);
+            stats.num_points = static_cast<size_t>(total_steps_) + 1;
+
+            std::vector<int32_t> block_x, block_y;
+            if (visitor) {
+                block_x.reserve(block_size);
+                block_y.reserve(block_size);
+            }
+
+            WalkBlock block;
+            block.start = stats.start;
+            block.speed = walker_speed_;
+            auto flush = [&]() {
+                block.count = block_x.size();
+                block.lattice_x = block_x.data();
+                block.lattice_y = block_y.data();
+                visitor(block);
+                block.first += block.count;
+                block_x.clear();
+                block_y.clear();
+            };
+
+            // Integer extents and squared offsets; converted to world units once at the end
+            int32_t x = 0, y = 0;
+            int32_t lo_x = 0, hi_x = 0, lo_y = 0, hi_y = 0;
+            double sum_squared = 0.0;
+            if (visitor) {
+                block_x.push_back(0);
+                block_y.push_back(0);
+            }
+
+            draw_directions(rng, [&](size_t, int dir) {
+                x += kStepX[dir];
+                y += kStepY[dir];
+                lo_x = std::min(lo_x, x);
+                hi_x = std::max(hi_x, x);
+                lo_y = std::min(lo_y, y);
+                hi_y = std::max(hi_y, y);
+                sum_squared += static_cast<double>(x) * x + static_cast<double>(y) * y;
+
+                if (visitor) {
+                    if (block_x.size() == block_size) {
+                        flush();
+                    }
+                    block_x.push_back(x);
+                    block_y.push_back(y);
+                }
+            });
+            if (visitor) {
+                flush();
+            }
+
+            // Same arithmetic as get_point(), so stats agree exactly with the generated walk
+            double speed = walker_speed_;
+            stats.end = datapod::Point{stats.start.x + speed * x, stats.start.y + speed * y, stats.start.z};
+            double x0 = stats.start.x + speed * lo_x, x1 = stats.start.x + speed * hi_x;
+            double y0 = stats.start.y + speed * lo_y, y1 = stats.start.y + speed * hi_y;
+            stats.min_x = std::min(x0, x1);
+            stats.max_x = std::max(x0, x1);
+            stats.min_y = std::min(y0, y1);
+            stats.max_y = std::max(y0, y1);
+            stats.mean_squared_displacement = speed * speed * sum_squared / static_cast<double>(total_steps_);
+            return stats;
+        }
+
+        inline datapod::Point RandomWalk::draw_startpoint(std::mt19937 &rng) const {
+            if (config_.rng == WalkRng::SplitMix64) {
+                return counter_startpoint();
+            }
+            return config_.random_start ? get_random_startpoint(rng) : datapod::Point{0.0, 0.0, 0.0};
+        }
+
+        // Calls visit(step, direction index) for steps 1..total_steps in order, advancing rng
+        template <typename F> inline void RandomWalk::draw_directions(std::mt19937 &rng, F &&visit) const {
+            size_t last = static_cast<size_t>(total_steps_) + 1;
+
+            if (config_.rng == WalkRng::SplitMix64) {
+                visit_counter_steps(1, last, visit);
+            } else if (config_.bulk_directions) {
+                // Neumann draws an index into N, E, S, W, which are every other Direction
+                if (config_.move_pattern == MovePattern::Moore) {
+                    draw_bulk_directions<3, 1>(rng, visit);
+                } else {
+                    draw_bulk_directions<2, 2>(rng, visit);
+                }
+            } else {
+                for (size_t step = 1; step < last; ++step) {
+                    visit(step, static_cast<int>(get_random_direction(rng)));
+                }
+            }
+        }
+
+        // Bits of RNG word per step; the drawn index times Scale is the Direction
+        template <int Bits, int Scale, typename F>
+        inline void RandomWalk::draw_bulk_directions(std::mt19937 &rng, F &&visit) const {
+            constexpr size_t per_word = 64 / Bits;
+            constexpr uint64_t mask = (uint64_t{1} << Bits) - 1;
+
+            // One RNG word per batch of steps
+            size_t last = static_cast<size_t>(total_steps_) + 1;
+            size_t step = 1;
+            while (step < last) {
+                uint64_t word = static_cast<uint64_t>(rng()) << 32;
+                word |= rng();
+
+                size_t end = std::min(last, step + per_word);
+                for (; step < end; ++step) {
+                    visit(step, static_cast<int>(word & mask) * Scale);
+                    word >>= Bits;
+                }
+            }
+        }
+
+        inline uint64_t RandomWalk::splitmix64(uint64_t z) {
+            z += 0x9E3779B97F4A7C15ull;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        // Word index of the SplitMix64 sequence keyed by (seed, stream): 0 = directions, 1 = start point
+        inline uint64_t RandomWalk::counter_word(uint64_t stream, uint64_t index) const {
+            uint64_t key = splitmix64(static_cast<uint32_t>(config_.seed) | (stream << 32));
+            return splitmix64(key + index * 0x9E3779B97F4A7C15ull);
+        }
+
+        inline datapod::Point RandomWalk::counter_startpoint() const {
+            if (!config_.random_start) {
+                return datapod::Point{0.0, 0.0, 0.0};
+            }
+
+            // Top 53 bits as a double in [0, 1), mapped to [-range, range)
+            double range = std::sqrt(static_cast<double>(total_steps_)) * config_.start_range_factor;
+            double u = static_cast<double>(counter_word(1, 0) >> 11) * 0x1.0p-53;
+            double v = static_cast<double>(counter_word(1, 1) >> 11) * 0x1.0p-53;
+            return datapod::Point{-range + 2.0 * range * u, -range + 2.0 * range * v, 0.0};
+        }
+
+        // Calls visit(step, direction index) for every step in [first, last), steps starting at 1
+        template <typename F>
+        inline void RandomWalk::visit_counter_steps(size_t first, size_t last, F &&visit) const {
+            if (config_.move_pattern == MovePattern::Moore) {
+                visit_counter_steps<3, 1>(first, last, visit);
+            } else {
+                visit_counter_steps<2, 2>(first, last, visit);
+            }
+        }
+
+        // Step s takes Bits bits at slot (s - 1) % per_word of word (s - 1) / per_word
+        template <int Bits, int Scale, typename F>
+        inline void RandomWalk::visit_counter_steps(size_t first, size_t last, F &&visit) const {
+            constexpr size_t per_word = 64 / Bits;
+            constexpr uint64_t mask = (uint64_t{1} << Bits) - 1;
+
+            size_t step = first;
+            while (step < last) {
+                size_t slot = (step - 1) % per_word;
+                uint64_t word = counter_word(0, (step - 1) / per_word) >> (slot * Bits);
+
+                size_t end = std::min(last, step + per_word - slot);
+                for (; step < end; ++step) {
+                    visit(step, static_cast<int>(word & mask) * Scale);
+                    word >>= Bits;
+                }
+            }
+        }
+
+        // Parallel SplitMix64 generation into the already sized lattice
+        inline void RandomWalk::generate_chunks() {
+            size_t count = lattice_x_.size();
+            int32_t *xs = lattice_x_.data();
+            int32_t *ys = lattice_y_.data();
+
+            // Fills [first, last) continuing from (x, y), the point at first - 1
+            auto fill = [&](size_t first, size_t last, int32_t x, int32_t y) {
+                visit_counter_steps(first, last, [&](size_t step, int dir) {
+                    x += kStepX[dir];
+                    y += kStepY[dir];
+                    xs[step] = x;
+                    ys[step] = y;
+                });
+            };
+
+            // A few chunks per thread for balance, but long enough to amortize the extra pass
+            const size_t min_chunk = 1 << 16;
+            size_t steps = count - 1;
+            size_t chunks = pool_ ? std::min(pool_->num_threads() * 4, steps / min_chunk) : 1;
+            if (chunks <= 1) {
+                fill(1, count, 0, 0);
+                return;
+            }
+
+            // Chunk c covers steps [1 + c * steps / chunks, 1 + (c + 1) * steps / chunks)
+            auto chunk_begin = [&](size_t c) { return 1 + c * steps / chunks; };
+
+            // Net offset of every chunk, then each chunk starts from the sum of the offsets before it
+            std::vector<std::array<int32_t, 2>> offsets(chunks);
+            pool_->parallel_for(chunks, [&](size_t c) {
+                int32_t x = 0, y = 0;
+                visit_counter_steps(chunk_begin(c), chunk_begin(c + 1), [&](size_t, int dir) {
+                    x += kStepX[dir];
+                    y += kStepY[dir];
+                });
+                offsets[c] = {x, y};
+            });
+
+            std::vector<std::array<int32_t, 2>> bases(chunks);
+            for (size_t c = 1; c < chunks; ++c) {
+                bases[c] = {bases[c - 1][0] + offsets[c - 1][0], bases[c - 1][1] + offsets[c - 1][1]};
+            }
+
+            pool_->parallel_for(chunks,
+                                [&](size_t c) { fill(chunk_begin(c), chunk_begin(c + 1), bases[c][0], bases[c][1]); });
+        }
 
-            // Set starting point
-            datapod::Point start_point;
-            if (config_.random_start) {
-                start_point = get_random_startpoint();
+        inline void RandomWalk::set_num_threads(size_t num_threads) {
+            if (num_threads == 1) {
+                pool_.reset();
             } else {
-                start_point = datapod::Point{0.0, 0.0, 0.0};
+                pool_ = std::make_shared<parallel::WorkStealingPool>(num_threads);
+            }
+        }
+
+        inline size_t RandomWalk::get_num_threads() const { return pool_ ? pool_->num_threads() : 1; }
+
+        inline datapod::Point RandomWalk::position_at(size_t step) const {
+            if (step > static_cast<size_t>(total_steps_)) {
+                throw std::out_of_range("step out of range");
+            }
+            if (step < lattice_x_.size()) {
+                return get_point(step);
             }
+            if (config_.rng != WalkRng::SplitMix64) {
+                throw std::logic_error("position_at before generate() needs WalkRng::SplitMix64");
+            }
+
+            int32_t x = 0, y = 0;
+            visit_counter_steps(1, step + 1, [&](size_t, int dir) {
+                x += kStepX[dir];
+                y += kStepY[dir];
+            });
 
-            // Add starting pose
-            path_.waypoints.push_back(datapod::Pose{start_point, datapod::Quaternion{}});
+            datapod::Point start = counter_startpoint();
+            return datapod::Point{start.x + walker_speed_ * x, start.y + walker_speed_ * y, start.z};
+        }
 
-            // Generate path
-            for (int step = 1; step <= total_steps_; ++step) {
-                Direction dir = get_random_direction();
-                plan_next_step(dir, path_.waypoints[path_.waypoints.size() - 1].point);
+        inline const datapod::Path &RandomWalk::get_path() const {
+            std::lock_guard<std::mutex> lock(path_.mutex);
+            if (!path_.built) {
+                for (size_t i = 0; i < lattice_x_.size(); ++i) {
+                    path_.path.waypoints.push_back(datapod::Pose{get_point(i), datapod::Quaternion{}});
+                }
+                path_.built = true;
             }
+            return path_.path;
         }
 
-        inline const datapod::Path &RandomWalk::get_path() const { return path_; }
+        inline size_t RandomWalk::num_points() const { return lattice_x_.size(); }
 
-        inline datapod::Path &RandomWalk::get_path() { return path_; }
+        inline datapod::Point RandomWalk::get_point(size_t index) const {
+            return datapod::Point{start_.x + walker_speed_ * lattice_x_[index],
+                                  start_.y + walker_speed_ * lattice_y_[index], start_.z};
+        }
+
+        inline void RandomWalk::add_to(OccupancyGrid &grid) const {
+            for (size_t i = 0; i < lattice_x_.size(); ++i) {
+                grid.add(start_.x + walker_speed_ * lattice_x_[i], start_.y + walker_speed_ * lattice_y_[i]);
+            }
+        }
+
+        inline const std::vector<int32_t> &RandomWalk::get_lattice_x() const { return lattice_x_; }
+
+        inline const std::vector<int32_t> &RandomWalk::get_lattice_y() const { return lattice_y_; }
 
         inline double RandomWalk::get_speed() const { return walker_speed_; }
 
@@ -234,17 +633,17 @@ namespace entropy {
         }
 
         inline datapod::Point RandomWalk::get_start_point() const {
-            if (path_.waypoints.empty()) {
-                return datapod::Point{};
+            if (lattice_x_.empty()) {
+                return config_.rng == WalkRng::SplitMix64 ? counter_startpoint() : datapod::Point{};
             }
-            return path_.waypoints[0].point;
+            return get_point(0);
         }
 
         inline datapod::Point RandomWalk::get_end_point() const {
-            if (path_.waypoints.empty()) {
-                return datapod::Point{};
+            if (lattice_x_.empty()) {
+                return config_.rng == WalkRng::SplitMix64 ? position_at(total_steps_) : datapod::Point{};
             }
-            return path_.waypoints[path_.waypoints.size() - 1].point;
+            return get_point(lattice_x_.size() - 1);
         }
 
         inline void RandomWalk::set_seed(int seed) {
@@ -303,8 +702,84 @@ namespace entropy {
         }
 
         inline void WalkSimulation::generate() {
-            for (auto &walker : walkers_) {
-                walker.generate();
+            for_each_walker([this](size_t i) { walkers_[i].generate(); });
+        }
+
+        inline void WalkSimulation::set_num_threads(size_t num_threads) {
+            if (num_threads == 1) {
+                pool_.reset();
+            } else {
+                pool_ = std::make_shared<parallel::WorkStealingPool>(num_threads);
+            }
+        }
+
+        inline size_t WalkSimulation::get_num_threads() const { return pool_ ? pool_->num_threads() : 1; }
+
+        inline void WalkSimulation::for_each_walker(const std::function<void(size_t)> &task) const {
+            if (pool_) {
+                pool_->parallel_for(walkers_.size(), task);
+            } else {
+                for (size_t i = 0; i < walkers_.size(); ++i) {
+                    task(i);
+                }
+            }
+        }
+
+        inline void WalkSimulation::generate(OccupancyGrid &grid) {
+            for_each_walker(grid, [this](size_t i, OccupancyGrid &local) {
+                walkers_[i].generate();
+                walkers_[i].add_to(local);
+            });
+        }
+
+        inline void WalkSimulation::stream(OccupancyGrid &grid, size_t block_size) const {
+            for_each_walker(grid, [this, block_size](size_t i, OccupancyGrid &local) {
+                walkers_[i].stream(
+                    [&](const WalkBlock &block) {
+                        for (size_t i = 0; i < block.count; ++i) {
+                            local.add(block.point(i));
+                        }
+                    },
+                    block_size);
+            });
+        }
+
+        // Runs task(walker index, grid) for every walker. In parallel each task gets a zeroed grid of the same
+        // layout that no other running task holds, so at most one per thread is created; they are merged into grid
+        inline void WalkSimulation::for_each_walker(OccupancyGrid &grid,
+                                                    const std::function<void(size_t, OccupancyGrid &)> &task) const {
+            if (!pool_) {
+                for (size_t i = 0; i < walkers_.size(); ++i) {
+                    task(i, grid);
+                }
+                return;
+            }
+
+            std::vector<std::unique_ptr<OccupancyGrid>> locals;
+            std::vector<OccupancyGrid *> idle;
+            std::mutex mutex;
+
+            pool_->parallel_for(walkers_.size(), [&](size_t i) {
+                OccupancyGrid *local = nullptr;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (idle.empty()) {
+                        locals.push_back(std::make_unique<OccupancyGrid>(grid.min_x(), grid.min_y(), grid.max_x(),
+                                                                         grid.max_y(), grid.width(), grid.height()));
+                        idle.push_back(locals.back().get());
+                    }
+                    local = idle.back();
+                    idle.pop_back();
+                }
+
+                task(i, *local);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                idle.push_back(local);
+            });
+
+            for (const auto &local : locals) {
+                grid.merge(*local);
             }
         }
 
@@ -333,19 +808,36 @@ namespace entropy {
                 return datapod::Box{};
             }
 
+            // Per-walker extents {min_x, max_x, min_y, max_y}, reduced afterwards
+            std::vector<std::array<double, 4>> extents(walkers_.size());
+            for_each_walker([&](size_t i) {
+                const RandomWalk &walker = walkers_[i];
+                if (walker.num_points() == 0) {
+                    extents[i] = {std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest(),
+                                  std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()};
+                    return;
+                }
+
+                // Points are monotonic in their lattice offsets, so the extreme offsets give the exact extents
+                auto [lo_x, hi_x] = std::minmax_element(walker.get_lattice_x().begin(), walker.get_lattice_x().end());
+                auto [lo_y, hi_y] = std::minmax_element(walker.get_lattice_y().begin(), walker.get_lattice_y().end());
+                datapod::Point start = walker.get_start_point();
+                double speed = walker.get_speed();
+                double x0 = start.x + speed * *lo_x, x1 = start.x + speed * *hi_x;
+                double y0 = start.y + speed * *lo_y, y1 = start.y + speed * *hi_y;
+                extents[i] = {std::min(x0, x1), std::max(x0, x1), std::min(y0, y1), std::max(y0, y1)};
+            });
+
             double min_x = std::numeric_limits<double>::max();
             double max_x = std::numeric_limits<double>::lowest();
             double min_y = std::numeric_limits<double>::max();
             double max_y = std::numeric_limits<double>::lowest();
 
-            for (const auto &walker : walkers_) {
-                const auto &path = walker.get_path();
-                for (const auto &pose : path.waypoints) {
-                    min_x = std::min(min_x, pose.point.x);
-                    max_x = std::max(max_x, pose.point.x);
-                    min_y = std::min(min_y, pose.point.y);
-                    max_y = std::max(max_y, pose.point.y);
-                }
+            for (const auto &extent : extents) {
+                min_x = std::min(min_x, extent[0]);
+                max_x = std::max(max_x, extent[1]);
+                min_y = std::min(min_y, extent[2]);
+                max_y = std::max(max_y, extent[3]);
             }
 
             // Create box using Pose (at center) and Size (dimensions)
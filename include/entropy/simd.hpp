@@ -0,0 +1,282 @@
+#pragma once
+
+// Runtime-dispatched SIMD kernels for NoiseGen.
+//
+// The kernels are written once in simd_kernels.hpp against GCC/Clang vector extensions and compiled
+// here several times, each inside its own namespace and target region (SSE4.1, AVX2, AVX-512 on x86,
+// NEON on aarch64). The library itself is built without any -m ISA flags; the best variant the CPU
+// supports is picked on first use, so one binary runs on every machine and uses what it has.
+//
+// Every variant evaluates the same operations in the same order as the scalar NoiseGen code, and each
+// region switches floating-point contraction off so the FMA units of AVX-512 and NEON are never used
+// behind its back. Results are bit-identical whichever level is active, provided the scalar code is
+// compiled with -ffp-contract=off as well.
+
+#include <atomic>
+
+#if !defined(ENTROPY_SIMD_DISABLED) && (defined(__GNUC__) || defined(__clang__))
+#if defined(__x86_64__) || defined(__i386__)
+#define ENTROPY_SIMD_X86
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define ENTROPY_SIMD_NEON
+#if defined(__linux__)
+#include <sys/auxv.h>
+#endif
+#endif
+#endif
+
+namespace entropy {
+    namespace noise {
+        namespace simd {
+
+            // Order matches NoiseGen::SimdLevel
+            enum Level { Level_Scalar, Level_SSE41, Level_AVX2, Level_AVX512, Level_NEON };
+
+            typedef void (*Simplex2DKernel)(int seed, const float *gradients2D, const float *x, const float *y,
+                                            float *out, int count);
+
+            // Cellular settings; enum fields hold NoiseGen::CellularDistanceFunction / CellularReturnType values
+            struct CellularParams {
+                const float *randVecs;
+                float jitterModifier;
+                int distanceFunction;
+                int returnType;
+            };
+
+            typedef void (*Cellular2DKernel)(int seed, const CellularParams &params, const float *x, const float *y,
+                                             float *out, int count);
+
+            typedef void (*Cellular3DKernel)(int seed, const CellularParams &params, const float *x, const float *y,
+                                             const float *z, float *out, int count);
+
+            // One entry per vectorized kernel; nullptr means the caller falls back to its scalar loop
+            struct KernelTable {
+                Level level;
+                Simplex2DKernel simplex2D;
+                Cellular2DKernel cellular2D;
+                Cellular3DKernel cellular3D;
+            };
+
+        } // namespace simd
+    } // namespace noise
+} // namespace entropy
+
+// ============ ISA VARIANTS ============
+
+#if defined(ENTROPY_SIMD_X86)
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("sse4.1"))), apply_to = function)
+#pragma float_control(push)
+#pragma clang fp contract(off)
+#else
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#pragma GCC optimize("fp-contract=off")
+#endif
+namespace entropy {
+    namespace noise {
+        namespace simd {
+            namespace sse41 {
+                typedef float vf __attribute__((vector_size(16)));
+                typedef int vi __attribute__((vector_size(16)));
+                const int W = 4;
+
+                inline vf Gather(const float *table, vi idx) {
+                    vf r;
+                    for (int i = 0; i < W; i++)
+                        r[i] = table[idx[i]];
+                    return r;
+                }
+
+                inline vf Sqrt(vf v) { return (vf)_mm_sqrt_ps((__m128)v); }
+
+#include "simd_kernels.hpp"
+            } // namespace sse41
+        } // namespace simd
+    } // namespace noise
+} // namespace entropy
+#if defined(__clang__)
+#pragma float_control(pop)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#pragma float_control(push)
+#pragma clang fp contract(off)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#pragma GCC optimize("fp-contract=off")
+#endif
+namespace entropy {
+    namespace noise {
+        namespace simd {
+            namespace avx2 {
+                typedef float vf __attribute__((vector_size(32)));
+                typedef int vi __attribute__((vector_size(32)));
+                const int W = 8;
+
+                inline vf Gather(const float *table, vi idx) {
+                    return (vf)_mm256_i32gather_ps(table, (__m256i)idx, 4);
+                }
+
+                inline vf Sqrt(vf v) { return (vf)_mm256_sqrt_ps((__m256)v); }
+
+#include "simd_kernels.hpp"
+            } // namespace avx2
+        } // namespace simd
+    } // namespace noise
+} // namespace entropy
+#if defined(__clang__)
+#pragma float_control(pop)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#pragma float_control(push)
+#pragma clang fp contract(off)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#pragma GCC optimize("fp-contract=off")
+#endif
+namespace entropy {
+    namespace noise {
+        namespace simd {
+            namespace avx512 {
+                typedef float vf __attribute__((vector_size(64)));
+                typedef int vi __attribute__((vector_size(64)));
+                const int W = 16;
+
+                inline vf Gather(const float *table, vi idx) {
+                    return (vf)_mm512_mask_i32gather_ps(_mm512_setzero_ps(), 0xFFFF, (__m512i)idx, table, 4);
+                }
+
+                inline vf Sqrt(vf v) { return (vf)_mm512_maskz_sqrt_ps(0xFFFF, (__m512)v); }
+
+#include "simd_kernels.hpp"
+            } // namespace avx512
+        } // namespace simd
+    } // namespace noise
+} // namespace entropy
+#if defined(__clang__)
+#pragma float_control(pop)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#elif defined(ENTROPY_SIMD_NEON)
+
+// NEON is part of the aarch64 baseline, so no target region is needed; only contraction is switched off
+#if defined(__clang__)
+#pragma float_control(push)
+#pragma clang fp contract(off)
+#else
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+namespace entropy {
+    namespace noise {
+        namespace simd {
+            namespace neon {
+                typedef float vf __attribute__((vector_size(16)));
+                typedef int vi __attribute__((vector_size(16)));
+                const int W = 4;
+
+                inline vf Gather(const float *table, vi idx) {
+                    vf r;
+                    for (int i = 0; i < W; i++)
+                        r[i] = table[idx[i]];
+                    return r;
+                }
+
+                inline vf Sqrt(vf v) {
+                    for (int i = 0; i < W; i++)
+                        v[i] = __builtin_sqrtf(v[i]);
+                    return v;
+                }
+
+#include "simd_kernels.hpp"
+            } // namespace neon
+        } // namespace simd
+    } // namespace noise
+} // namespace entropy
+#if defined(__clang__)
+#pragma float_control(pop)
+#else
+#pragma GCC pop_options
+#endif
+
+#endif
+
+// ============ DISPATCH ============
+
+namespace entropy {
+    namespace noise {
+        namespace simd {
+
+            inline constexpr KernelTable ScalarTable = {Level_Scalar, nullptr, nullptr, nullptr};
+#if defined(ENTROPY_SIMD_X86)
+            inline constexpr KernelTable SSE41Table = {Level_SSE41, &sse41::Simplex2D, &sse41::Cellular2D, &sse41::Cellular3D};
+            inline constexpr KernelTable AVX2Table = {Level_AVX2, &avx2::Simplex2D, &avx2::Cellular2D, &avx2::Cellular3D};
+            inline constexpr KernelTable AVX512Table = {Level_AVX512, &avx512::Simplex2D, &avx512::Cellular2D, &avx512::Cellular3D};
+#elif defined(ENTROPY_SIMD_NEON)
+            inline constexpr KernelTable NEONTable = {Level_NEON, &neon::Simplex2D, &neon::Cellular2D, &neon::Cellular3D};
+#endif
+
+            // Returns the kernels for a level, or nullptr if this build or CPU can't run it
+            inline const KernelTable *Supported(Level level) {
+                switch (level) {
+                case Level_Scalar:
+                    return &ScalarTable;
+#if defined(ENTROPY_SIMD_X86)
+                case Level_SSE41:
+                    __builtin_cpu_init();
+                    return __builtin_cpu_supports("sse4.1") ? &SSE41Table : nullptr;
+                case Level_AVX2:
+                    __builtin_cpu_init();
+                    return __builtin_cpu_supports("avx2") ? &AVX2Table : nullptr;
+                case Level_AVX512:
+                    __builtin_cpu_init();
+                    return __builtin_cpu_supports("avx512f") ? &AVX512Table : nullptr;
+#elif defined(ENTROPY_SIMD_NEON)
+                case Level_NEON:
+#if defined(__linux__)
+                    return (getauxval(AT_HWCAP) & HWCAP_ASIMD) ? &NEONTable : nullptr;
+#else
+                    return &NEONTable;
+#endif
+#endif
+                default:
+                    return nullptr;
+                }
+            }
+
+            inline const KernelTable *Detect() {
+                const Level preferred[] = {Level_AVX512, Level_AVX2, Level_SSE41, Level_NEON};
+                for (Level level : preferred) {
+                    if (const KernelTable *table = Supported(level))
+                        return table;
+                }
+                return &ScalarTable;
+            }
+
+            inline std::atomic<const KernelTable *> &ActiveSlot() {
+                static std::atomic<const KernelTable *> slot{Detect()};
+                return slot;
+            }
+
+            inline const KernelTable &Active() { return *ActiveSlot().load(std::memory_order_relaxed); }
+
+        } // namespace simd
+    } // namespace noise
+} // namespace entropy
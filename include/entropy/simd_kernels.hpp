@@ -0,0 +1,327 @@
+// Vector kernel bodies shared by every ISA variant in simd.hpp.
+//
+// Deliberately no include guard: simd.hpp includes this file once per ISA namespace, after defining
+// `vf` / `vi` (float / int vectors of `W` lanes), `Gather(table, idx)` and `Sqrt(v)` for that ISA.
+// Only operators and lane-wise conversions are used here, so the same source maps onto each target.
+
+// Same primes and hash as NoiseGen
+const int PrimeX = 501125321;
+const int PrimeY = 1136930381;
+const int PrimeZ = 1720413743;
+
+// NoiseGen::CellularDistanceFunction / CellularReturnType values
+enum { Euclidean, EuclideanSq, Manhattan, Hybrid };
+enum { CellValue, Distance, Distance2, Distance2Add, Distance2Sub, Distance2Mul, Distance2Div };
+
+inline vf Load(const float *p) {
+    vf v;
+    __builtin_memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline void Store(float *p, vf v) { __builtin_memcpy(p, &v, sizeof(v)); }
+
+inline vf Select(vi mask, vf a, vf b) { return (vf)(((vi)a & mask) | ((vi)b & ~mask)); }
+
+inline vi Select(vi mask, vi a, vi b) { return (a & mask) | (b & ~mask); }
+
+inline vf Mask(vi mask, vf a) { return (vf)((vi)a & mask); }
+
+inline vf Min(vf a, vf b) { return Select(a < b, a, b); }
+
+inline vf Max(vf a, vf b) { return Select(a > b, a, b); }
+
+inline vf Abs(vf f) { return Select(f < 0.0f, -f, f); }
+
+inline vi FastFloor(vf f) {
+    // (int)f, minus one where !(f >= 0) - NaN lanes take the same branch as the scalar ternary
+    return __builtin_convertvector(f, vi) + ~(f >= 0.0f);
+}
+
+inline vi FastRound(vf f) { return __builtin_convertvector(Select(f >= 0.0f, f + 0.5f, f - 0.5f), vi); }
+
+inline vf GradCoord(vi seed, vi xPrimed, vi yPrimed, vf xd, vf yd, const float *gradients2D) {
+    vi hash = seed ^ xPrimed ^ yPrimed;
+    hash *= 0x27d4eb2d;
+    hash ^= hash >> 15;
+    hash &= 127 << 1;
+
+    vf xg = Gather(gradients2D, hash);
+    vf yg = Gather(gradients2D, hash | 1);
+
+    return xd * xg + yd * yg;
+}
+
+// W lanes of NoiseGen::SingleSimplex
+inline vf Simplex2DLanes(vi seed, vf x, vf y, const float *gradients2D) {
+    const float SQRT3 = 1.7320508075688772935274463415059f;
+    const float G2 = (3 - SQRT3) / 6;
+
+    vi i = FastFloor(x);
+    vi j = FastFloor(y);
+    vf xi = x - __builtin_convertvector(i, vf);
+    vf yi = y - __builtin_convertvector(j, vf);
+
+    vf t = (xi + yi) * G2;
+    vf x0 = xi - t;
+    vf y0 = yi - t;
+
+    i *= PrimeX;
+    j *= PrimeY;
+
+    vf a = 0.5f - x0 * x0 - y0 * y0;
+    vf n0 = Mask(a > 0.0f, (a * a) * (a * a) * GradCoord(seed, i, j, x0, y0, gradients2D));
+
+    vf c = (float)(2 * (1 - 2 * G2) * (1 / G2 - 2)) * t + ((float)(-2 * (1 - 2 * G2) * (1 - 2 * G2)) + a);
+    vf x2 = x0 + (2 * (float)G2 - 1);
+    vf y2 = y0 + (2 * (float)G2 - 1);
+    vf n2 = Mask(c > 0.0f, (c * c) * (c * c) * GradCoord(seed, i + PrimeX, j + PrimeY, x2, y2, gradients2D));
+
+    // y0 > x0 selects the (0, 1) corner, otherwise (1, 0)
+    vi upper = y0 > x0;
+    vf x1 = x0 + Select(upper, vf{} + (float)G2, vf{} + ((float)G2 - 1));
+    vf y1 = y0 + Select(upper, vf{} + ((float)G2 - 1), vf{} + (float)G2);
+    vi i1 = i + (~upper & PrimeX);
+    vi j1 = j + (upper & PrimeY);
+
+    vf b = 0.5f - x1 * x1 - y1 * y1;
+    vf n1 = Mask(b > 0.0f, (b * b) * (b * b) * GradCoord(seed, i1, j1, x1, y1, gradients2D));
+
+    return (n0 + n1 + n2) * 99.83685446303647f;
+}
+
+inline void Simplex2D(int seed, const float *gradients2D, const float *x, const float *y, float *out, int count) {
+    vi seedv = vi{} + seed;
+    int i = 0;
+    for (; i + W <= count; i += W)
+        Store(out + i, Simplex2DLanes(seedv, Load(x + i), Load(y + i), gradients2D));
+
+    if (i < count) {
+        // Pad the tail to a full vector; lanes are independent so the padding never affects results
+        float xt[W] = {}, yt[W] = {}, ot[W];
+        for (int k = 0; i + k < count; k++) {
+            xt[k] = x[i + k];
+            yt[k] = y[i + k];
+        }
+        Store(ot, Simplex2DLanes(seedv, Load(xt), Load(yt), gradients2D));
+        for (int k = 0; i + k < count; k++)
+            out[i + k] = ot[k];
+    }
+}
+
+// W lanes of NoiseGen::SingleCellular, one sample per lane walking the 3x3 / 3x3x3 neighbourhood
+
+inline vf CellularResult(vf distance0, vf distance1, vi closestHash, const CellularParams &params) {
+    if (params.distanceFunction == Euclidean && params.returnType >= Distance) {
+        distance0 = Sqrt(distance0);
+
+        if (params.returnType >= Distance2) {
+            distance1 = Sqrt(distance1);
+        }
+    }
+
+    switch (params.returnType) {
+    case CellValue:
+        return __builtin_convertvector(closestHash, vf) * (1 / 2147483648.0f);
+    case Distance:
+        return distance0 - 1;
+    case Distance2:
+        return distance1 - 1;
+    case Distance2Add:
+        return (distance1 + distance0) * 0.5f - 1;
+    case Distance2Sub:
+        return distance1 - distance0 - 1;
+    case Distance2Mul:
+        return distance1 * distance0 * 0.5f - 1;
+    case Distance2Div:
+        return distance0 / distance1 - 1;
+    default:
+        return vf{};
+    }
+}
+
+template <int DistanceFunction> inline vf CellularDistance(vf vecX, vf vecY) {
+    switch (DistanceFunction) {
+    case Manhattan:
+        return Abs(vecX) + Abs(vecY);
+    case Hybrid:
+        return (Abs(vecX) + Abs(vecY)) + (vecX * vecX + vecY * vecY);
+    default:
+        return vecX * vecX + vecY * vecY;
+    }
+}
+
+template <int DistanceFunction> inline vf CellularDistance(vf vecX, vf vecY, vf vecZ) {
+    switch (DistanceFunction) {
+    case Manhattan:
+        return Abs(vecX) + Abs(vecY) + Abs(vecZ);
+    case Hybrid:
+        return (Abs(vecX) + Abs(vecY) + Abs(vecZ)) + (vecX * vecX + vecY * vecY + vecZ * vecZ);
+    default:
+        return vecX * vecX + vecY * vecY + vecZ * vecZ;
+    }
+}
+
+template <int DistanceFunction>
+inline vf Cellular2DLanes(vi seed, vf x, vf y, const CellularParams &params) {
+    vi xr = FastRound(x);
+    vi yr = FastRound(y);
+
+    vf distance0 = vf{} + 1e10f;
+    vf distance1 = vf{} + 1e10f;
+    vi closestHash = vi{};
+
+    float cellularJitter = 0.43701595f * params.jitterModifier;
+
+    vi xPrimed = (xr - 1) * PrimeX;
+    vi yPrimedBase = (yr - 1) * PrimeY;
+
+    for (int xo = -1; xo <= 1; xo++) {
+        vf xd = __builtin_convertvector(xr + xo, vf) - x;
+        vi yPrimed = yPrimedBase;
+
+        for (int yo = -1; yo <= 1; yo++) {
+            vf yd = __builtin_convertvector(yr + yo, vf) - y;
+
+            vi hash = (seed ^ xPrimed ^ yPrimed) * 0x27d4eb2d;
+            vi idx = hash & (255 << 1);
+
+            vf vecX = xd + Gather(params.randVecs, idx) * cellularJitter;
+            vf vecY = yd + Gather(params.randVecs, idx | 1) * cellularJitter;
+
+            vf newDistance = CellularDistance<DistanceFunction>(vecX, vecY);
+
+            distance1 = Max(Min(distance1, newDistance), distance0);
+            vi closer = newDistance < distance0;
+            distance0 = Select(closer, newDistance, distance0);
+            closestHash = Select(closer, hash, closestHash);
+
+            yPrimed += PrimeY;
+        }
+        xPrimed += PrimeX;
+    }
+
+    return CellularResult(distance0, distance1, closestHash, params);
+}
+
+template <int DistanceFunction>
+inline vf Cellular3DLanes(vi seed, vf x, vf y, vf z, const CellularParams &params) {
+    vi xr = FastRound(x);
+    vi yr = FastRound(y);
+    vi zr = FastRound(z);
+
+    vf distance0 = vf{} + 1e10f;
+    vf distance1 = vf{} + 1e10f;
+    vi closestHash = vi{};
+
+    float cellularJitter = 0.39614353f * params.jitterModifier;
+
+    vi xPrimed = (xr - 1) * PrimeX;
+    vi yPrimedBase = (yr - 1) * PrimeY;
+    vi zPrimedBase = (zr - 1) * PrimeZ;
+
+    for (int xo = -1; xo <= 1; xo++) {
+        vf xd = __builtin_convertvector(xr + xo, vf) - x;
+        vi yPrimed = yPrimedBase;
+
+        for (int yo = -1; yo <= 1; yo++) {
+            vf yd = __builtin_convertvector(yr + yo, vf) - y;
+            vi zPrimed = zPrimedBase;
+
+            for (int zo = -1; zo <= 1; zo++) {
+                vf zd = __builtin_convertvector(zr + zo, vf) - z;
+
+                vi hash = (seed ^ xPrimed ^ yPrimed ^ zPrimed) * 0x27d4eb2d;
+                vi idx = hash & (255 << 2);
+
+                vf vecX = xd + Gather(params.randVecs, idx) * cellularJitter;
+                vf vecY = yd + Gather(params.randVecs, idx | 1) * cellularJitter;
+                vf vecZ = zd + Gather(params.randVecs, idx | 2) * cellularJitter;
+
+                vf newDistance = CellularDistance<DistanceFunction>(vecX, vecY, vecZ);
+
+                distance1 = Max(Min(distance1, newDistance), distance0);
+                vi closer = newDistance < distance0;
+                distance0 = Select(closer, newDistance, distance0);
+                closestHash = Select(closer, hash, closestHash);
+
+                zPrimed += PrimeZ;
+            }
+            yPrimed += PrimeY;
+        }
+        xPrimed += PrimeX;
+    }
+
+    return CellularResult(distance0, distance1, closestHash, params);
+}
+
+template <int DistanceFunction>
+inline void Cellular2DRun(int seed, const CellularParams &params, const float *x, const float *y, float *out,
+                          int count) {
+    vi seedv = vi{} + seed;
+    int i = 0;
+    for (; i + W <= count; i += W)
+        Store(out + i, Cellular2DLanes<DistanceFunction>(seedv, Load(x + i), Load(y + i), params));
+
+    if (i < count) {
+        float xt[W] = {}, yt[W] = {}, ot[W];
+        for (int k = 0; i + k < count; k++) {
+            xt[k] = x[i + k];
+            yt[k] = y[i + k];
+        }
+        Store(ot, Cellular2DLanes<DistanceFunction>(seedv, Load(xt), Load(yt), params));
+        for (int k = 0; i + k < count; k++)
+            out[i + k] = ot[k];
+    }
+}
+
+template <int DistanceFunction>
+inline void Cellular3DRun(int seed, const CellularParams &params, const float *x, const float *y, const float *z,
+                          float *out, int count) {
+    vi seedv = vi{} + seed;
+    int i = 0;
+    for (; i + W <= count; i += W)
+        Store(out + i, Cellular3DLanes<DistanceFunction>(seedv, Load(x + i), Load(y + i), Load(z + i), params));
+
+    if (i < count) {
+        float xt[W] = {}, yt[W] = {}, zt[W] = {}, ot[W];
+        for (int k = 0; i + k < count; k++) {
+            xt[k] = x[i + k];
+            yt[k] = y[i + k];
+            zt[k] = z[i + k];
+        }
+        Store(ot, Cellular3DLanes<DistanceFunction>(seedv, Load(xt), Load(yt), Load(zt), params));
+        for (int k = 0; i + k < count; k++)
+            out[i + k] = ot[k];
+    }
+}
+
+// Distance function is resolved once per call so the neighbourhood loop stays branch free
+inline void Cellular2D(int seed, const CellularParams &params, const float *x, const float *y, float *out, int count) {
+    switch (params.distanceFunction) {
+    case Manhattan:
+        Cellular2DRun<Manhattan>(seed, params, x, y, out, count);
+        break;
+    case Hybrid:
+        Cellular2DRun<Hybrid>(seed, params, x, y, out, count);
+        break;
+    default:
+        Cellular2DRun<Euclidean>(seed, params, x, y, out, count);
+        break;
+    }
+}
+
+inline void Cellular3D(int seed, const CellularParams &params, const float *x, const float *y, const float *z,
+                       float *out, int count) {
+    switch (params.distanceFunction) {
+    case Manhattan:
+        Cellular3DRun<Manhattan>(seed, params, x, y, z, out, count);
+        break;
+    case Hybrid:
+        Cellular3DRun<Hybrid>(seed, params, x, y, z, out, count);
+        break;
+    default:
+        Cellular3DRun<Euclidean>(seed, params, x, y, z, out, count);
+        break;
+    }
+}
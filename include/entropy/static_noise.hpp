@@ -0,0 +1,141 @@
+#pragma once
+
+#include "generator.hpp"
+
+namespace entropy {
+    namespace noise {
+
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal = NoiseGen::FractalType_None,
+                  NoiseGen::CellularDistanceFunction Distance = NoiseGen::CellularDistanceFunction_EuclideanSq,
+                  NoiseGen::CellularReturnType Return = NoiseGen::CellularReturnType_Distance, int Octaves = 3>
+        class StaticNoise {
+            static_assert(Octaves >= 1, "StaticNoise needs at least one octave");
+
+          public:
+            StaticNoise(int seed = 1337);
+
+            void SetSeed(int seed);
+
+            void SetFrequency(float frequency);
+
+            void SetRotationType3D(NoiseGen::RotationType3D rotationType3D);
+
+            void SetFractalLacunarity(float lacunarity);
+
+            void SetFractalGain(float gain);
+
+            void SetFractalWeightedStrength(float weightedStrength);
+
+            void SetFractalPingPongStrength(float pingPongStrength);
+
+            void SetCellularJitter(float cellularJitter);
+
+            float GetNoise(float x, float y) const;
+
+            float GetNoise(float x, float y, float z) const;
+
+            const NoiseGen &GetNoiseGen() const;
+
+          private:
+            NoiseGen mGen;
+        };
+
+        // ============ IMPLEMENTATION ============
+
+        /// <summary>
+        /// Noise generator with noise type, fractal type, cellular settings and octave count fixed at compile time
+        /// </summary>
+        /// <remarks>
+        /// GetNoise(...) returns exactly what a NoiseGen with the same settings returns, without any per-sample
+        /// or per-octave configuration switches. Remaining settings stay runtime configurable.
+        /// </remarks>
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline StaticNoise<Noise, Fractal, Distance, Return, Octaves>::StaticNoise(int seed) : mGen(seed) {
+            mGen.SetNoiseType(Noise);
+            mGen.SetFractalType(Fractal);
+            mGen.SetFractalOctaves(Octaves);
+            mGen.SetCellularDistanceFunction(Distance);
+            mGen.SetCellularReturnType(Return);
+        }
+
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline void StaticNoise<Noise, Fractal, Distance, Return, Octaves>::SetSeed(int seed) {
+            mGen.SetSeed(seed);
+        }
+
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline void StaticNoise<Noise, Fractal, Distance, Return, Octaves>::SetFrequency(float frequency) {
+            mGen.SetFrequency(frequency);
+        }
+
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline void
+        StaticNoise<Noise, Fractal, Distance, Return, Octaves>::SetRotationType3D(NoiseGen::RotationType3D rotationType3D) {
+            mGen.SetRotationType3D(rotationType3D);
+        }
+
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline void StaticNoise<Noise, Fractal, Distance, Return, Octaves>::SetFractalLacunarity(float lacunarity) {
+            mGen.SetFractalLacunarity(lacunarity);
+        }
+
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline void StaticNoise<Noise, Fractal, Distance, Return, Octaves>::SetFractalGain(float gain) {
+            mGen.SetFractalGain(gain);
+        }
+
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline void
+        StaticNoise<Noise, Fractal, Distance, Return, Octaves>::SetFractalWeightedStrength(float weightedStrength) {
+            mGen.SetFractalWeightedStrength(weightedStrength);
+        }
+
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline void
+        StaticNoise<Noise, Fractal, Distance, Return, Octaves>::SetFractalPingPongStrength(float pingPongStrength) {
+            mGen.SetFractalPingPongStrength(pingPongStrength);
+        }
+
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline void StaticNoise<Noise, Fractal, Distance, Return, Octaves>::SetCellularJitter(float cellularJitter) {
+            mGen.SetCellularJitter(cellularJitter);
+        }
+
+        /// <summary>
+        /// 2D noise at given position, identical to NoiseGen::GetNoise with the same settings
+        /// </summary>
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline float StaticNoise<Noise, Fractal, Distance, Return, Octaves>::GetNoise(float x, float y) const {
+            return mGen.template GetNoiseT<Noise, Fractal, Distance, Return, Octaves>(x, y);
+        }
+
+        /// <summary>
+        /// 3D noise at given position, identical to NoiseGen::GetNoise with the same settings
+        /// </summary>
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline float StaticNoise<Noise, Fractal, Distance, Return, Octaves>::GetNoise(float x, float y, float z) const {
+            return mGen.template GetNoiseT<Noise, Fractal, Distance, Return, Octaves>(x, y, z);
+        }
+
+        /// <summary>
+        /// Runtime generator holding the same configuration, e.g. for grid generation or domain warping
+        /// </summary>
+        template <NoiseGen::NoiseType Noise, NoiseGen::FractalType Fractal, NoiseGen::CellularDistanceFunction Distance,
+                  NoiseGen::CellularReturnType Return, int Octaves>
+        inline const NoiseGen &StaticNoise<Noise, Fractal, Distance, Return, Octaves>::GetNoiseGen() const {
+            return mGen;
+        }
+
+    } // namespace noise
+} // namespace entropy
@@ -0,0 +1,398 @@
+// Spatial index over generated random walks
+// Uniform hash grid of path segments for proximity and intersection queries
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <datapod/datapod.hpp>
+#include <stdexcept>
+#include <vector>
+
+#include "path.hpp"
+
+namespace entropy {
+    namespace path {
+
+        // Segment step of a walker, from point step - 1 to point step
+        struct WalkSegment {
+            size_t walker = 0;
+            size_t step = 0;
+
+            bool operator==(const WalkSegment &other) const { return walker == other.walker && step == other.step; }
+            bool operator<(const WalkSegment &other) const {
+                return walker != other.walker ? walker < other.walker : step < other.step;
+            }
+        };
+
+        class WalkIndex {
+          public:
+            // Index the segments of already generated walks. The walkers are referenced, not copied: they must
+            // outlive the index and not be regenerated while it is used.
+            // cell_size <= 0 picks twice the largest walker speed, so each segment touches at most 4 cells
+            explicit WalkIndex(const std::vector<RandomWalk> &walkers, double cell_size = 0.0);
+            explicit WalkIndex(const WalkSimulation &simulation, double cell_size = 0.0);
+
+            // Segments passing within radius of center, sorted by walker then step
+            std::vector<WalkSegment> query_radius(const datapod::Point &center, double radius) const;
+
+            // Walkers whose path passes within radius of center, sorted
+            std::vector<size_t> walkers_within(const datapod::Point &center, double radius) const;
+
+            // Segments intersecting the closed box [min_x, max_x] x [min_y, max_y], sorted by walker then step
+            std::vector<WalkSegment> query_box(double min_x, double min_y, double max_x, double max_y) const;
+
+            // Segments intersecting the segment from a to b, sorted by walker then step
+            std::vector<WalkSegment> query_segment(const datapod::Point &a, const datapod::Point &b) const;
+
+            // Earliest segment of walker a whose path crosses or touches the path of walker b, with the earliest
+            // such segment of b. Returns false if their paths never meet
+            bool first_crossing(size_t a, size_t b, WalkSegment &hit_a, WalkSegment &hit_b) const;
+
+            size_t num_segments() const;
+            double cell_size() const;
+
+          private:
+            struct Entry {
+                uint32_t walker;
+                uint32_t step;
+            };
+
+            const std::vector<RandomWalk> *walkers_;
+            size_t num_segments_ = 0;
+            double cell_size_;
+            double inv_cell_;
+            uint64_t mask_;
+
+            // Entries of bucket i are entries_[offsets_[i], offsets_[i + 1]), sorted by walker then step.
+            // A bucket mixes every cell hashing to it
+            std::vector<size_t> offsets_;
+            std::vector<Entry> entries_;
+
+            int64_t cell_coord(double v) const;
+            size_t bucket(int64_t cx, int64_t cy) const;
+            void segment_points(size_t walker, size_t step, datapod::Point &a, datapod::Point &b) const;
+
+            // Calls visit(entry) for every entry stored in a cell overlapping the box, possibly more than once
+            template <typename F>
+            void visit_box(double min_x, double min_y, double max_x, double max_y, F &&visit) const;
+
+            // Same, restricted to one walker's entries (binary search, as each bucket is sorted by walker)
+            template <typename F>
+            void visit_box(size_t walker, double min_x, double min_y, double max_x, double max_y, F &&visit) const;
+
+            static double segment_distance_squared(const datapod::Point &p, const datapod::Point &a,
+                                                   const datapod::Point &b);
+            static bool segment_intersects_box(const datapod::Point &a, const datapod::Point &b, double min_x,
+                                               double min_y, double max_x, double max_y);
+            static bool segments_intersect(const datapod::Point &a, const datapod::Point &b, const datapod::Point &c,
+                                           const datapod::Point &d);
+
+            static std::vector<WalkSegment> sorted_unique(std::vector<WalkSegment> hits);
+        };
+
+        // ============ IMPLEMENTATION ============
+
+        inline WalkIndex::WalkIndex(const std::vector<RandomWalk> &walkers, double cell_size) : walkers_(&walkers) {
+            if (walkers.size() > UINT32_MAX) {
+                throw std::invalid_argument("too many walkers to index");
+            }
+
+            double max_speed = 0.0;
+            for (const auto &walker : walkers) {
+                if (walker.num_points() > 1) {
+                    num_segments_ += walker.num_points() - 1;
+                    max_speed = std::max(max_speed, std::abs(walker.get_speed()));
+                }
+            }
+
+            cell_size_ = cell_size > 0.0 ? cell_size : (max_speed > 0.0 ? 2.0 * max_speed : 1.0);
+            inv_cell_ = 1.0 / cell_size_;
+
+            // About four segments per bucket keeps the offsets small next to the entries
+            uint64_t buckets = 1;
+            while (buckets * 4 < num_segments_) {
+                buckets <<= 1;
+            }
+            mask_ = buckets - 1;
+
+            // Counting sort of (segment, cell) pairs by bucket: count, prefix sum, fill
+            auto for_each_cell = [&](auto &&emit) {
+                for (size_t w = 0; w < walkers.size(); ++w) {
+                    for (size_t s = 1; s < walkers[w].num_points(); ++s) {
+                        datapod::Point a, b;
+                        segment_points(w, s, a, b);
+                        int64_t cx0 = cell_coord(std::min(a.x, b.x)), cx1 = cell_coord(std::max(a.x, b.x));
+                        int64_t cy0 = cell_coord(std::min(a.y, b.y)), cy1 = cell_coord(std::max(a.y, b.y));
+                        for (int64_t cy = cy0; cy <= cy1; ++cy) {
+                            for (int64_t cx = cx0; cx <= cx1; ++cx) {
+                                emit(bucket(cx, cy), Entry{static_cast<uint32_t>(w), static_cast<uint32_t>(s)});
+                            }
+                        }
+                    }
+                }
+            };
+
+            offsets_.assign(buckets + 1, 0);
+            for_each_cell([&](size_t b, const Entry &) { ++offsets_[b + 1]; });
+            for (size_t b = 0; b < buckets; ++b) {
+                offsets_[b + 1] += offsets_[b];
+            }
+
+            entries_.resize(offsets_.back());
+            std::vector<size_t> cursor(offsets_.begin(), offsets_.end() - 1);
+            for_each_cell([&](size_t b, const Entry &entry) { entries_[cursor[b]++] = entry; });
+        }
+
+        inline WalkIndex::WalkIndex(const WalkSimulation &simulation, double cell_size)
+            : WalkIndex(simulation.get_walkers(), cell_size) {}
+
+        inline std::vector<WalkSegment> WalkIndex::query_radius(const datapod::Point &center, double radius) const {
+            std::vector<WalkSegment> hits;
+            if (!(radius >= 0.0)) {
+                return hits;
+            }
+
+            double radius_squared = radius * radius;
+            visit_box(center.x - radius, center.y - radius, center.x + radius, center.y + radius,
+                      [&](const Entry &entry) {
+                          datapod::Point a, b;
+                          segment_points(entry.walker, entry.step, a, b);
+                          if (segment_distance_squared(center, a, b) <= radius_squared) {
+                              hits.push_back({entry.walker, entry.step});
+                          }
+                      });
+            return sorted_unique(std::move(hits));
+        }
+
+        inline std::vector<size_t> WalkIndex::walkers_within(const datapod::Point &center, double radius) const {
+            std::vector<size_t> walkers;
+            for (const auto &hit : query_radius(center, radius)) {
+                if (walkers.empty() || walkers.back() != hit.walker) {
+                    walkers.push_back(hit.walker);
+                }
+            }
+            return walkers;
+        }
+
+        inline std::vector<WalkSegment> WalkIndex::query_box(double min_x, double min_y, double max_x,
+                                                             double max_y) const {
+            std::vector<WalkSegment> hits;
+            if (!(max_x >= min_x) || !(max_y >= min_y)) {
+                return hits;
+            }
+
+            visit_box(min_x, min_y, max_x, max_y, [&](const Entry &entry) {
+                datapod::Point a, b;
+                segment_points(entry.walker, entry.step, a, b);
+                if (segment_intersects_box(a, b, min_x, min_y, max_x, max_y)) {
+                    hits.push_back({entry.walker, entry.step});
+                }
+            });
+            return sorted_unique(std::move(hits));
+        }
+
+        inline std::vector<WalkSegment> WalkIndex::query_segment(const datapod::Point &a,
+                                                                 const datapod::Point &b) const {
+            std::vector<WalkSegment> hits;
+            visit_box(std::min(a.x, b.x), std::min(a.y, b.y), std::max(a.x, b.x), std::max(a.y, b.y),
+                      [&](const Entry &entry) {
+                          datapod::Point c, d;
+                          segment_points(entry.walker, entry.step, c, d);
+                          if (segments_intersect(a, b, c, d)) {
+                              hits.push_back({entry.walker, entry.step});
+                          }
+                      });
+            return sorted_unique(std::move(hits));
+        }
+
+        inline bool WalkIndex::first_crossing(size_t a, size_t b, WalkSegment &hit_a, WalkSegment &hit_b) const {
+            if (a >= walkers_->size() || b >= walkers_->size()) {
+                throw std::out_of_range("walker index out of range");
+            }
+            if (a == b) {
+                throw std::invalid_argument("first_crossing needs two different walkers");
+            }
+
+            const RandomWalk &walker = (*walkers_)[a];
+            for (size_t s = 1; s < walker.num_points(); ++s) {
+                datapod::Point p, q;
+                segment_points(a, s, p, q);
+
+                size_t best = SIZE_MAX;
+                visit_box(b, std::min(p.x, q.x), std::min(p.y, q.y), std::max(p.x, q.x), std::max(p.y, q.y),
+                          [&](const Entry &entry) {
+                              if (entry.step >= best) {
+                                  return;
+                              }
+                              datapod::Point c, d;
+                              segment_points(b, entry.step, c, d);
+                              if (segments_intersect(p, q, c, d)) {
+                                  best = entry.step;
+                              }
+                          });
+
+                if (best != SIZE_MAX) {
+                    hit_a = {a, s};
+                    hit_b = {b, best};
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        inline size_t WalkIndex::num_segments() const { return num_segments_; }
+
+        inline double WalkIndex::cell_size() const { return cell_size_; }
+
+        inline int64_t WalkIndex::cell_coord(double v) const {
+            return static_cast<int64_t>(std::floor(v * inv_cell_));
+        }
+
+        inline size_t WalkIndex::bucket(int64_t cx, int64_t cy) const {
+            uint64_t h = static_cast<uint64_t>(cx) * 0x9E3779B97F4A7C15ull;
+            h ^= static_cast<uint64_t>(cy) * 0xC2B2AE3D27D4EB4Full;
+            h ^= h >> 32;
+            return static_cast<size_t>(h & mask_);
+        }
+
+        inline void WalkIndex::segment_points(size_t walker, size_t step, datapod::Point &a, datapod::Point &b) const {
+            const RandomWalk &w = (*walkers_)[walker];
+            a = w.get_point(step - 1);
+            b = w.get_point(step);
+        }
+
+        template <typename F>
+        inline void WalkIndex::visit_box(double min_x, double min_y, double max_x, double max_y, F &&visit) const {
+            if (entries_.empty()) {
+                return;
+            }
+
+            int64_t cx0 = cell_coord(min_x), cx1 = cell_coord(max_x);
+            int64_t cy0 = cell_coord(min_y), cy1 = cell_coord(max_y);
+
+            // Covering more cells than there are buckets visits every bucket anyway
+            double cells = (static_cast<double>(cx1) - cx0 + 1) * (static_cast<double>(cy1) - cy0 + 1);
+            if (cells > static_cast<double>(mask_ + 1)) {
+                for (const auto &entry : entries_) {
+                    visit(entry);
+                }
+                return;
+            }
+
+            for (int64_t cy = cy0; cy <= cy1; ++cy) {
+                for (int64_t cx = cx0; cx <= cx1; ++cx) {
+                    size_t b = bucket(cx, cy);
+                    for (size_t i = offsets_[b]; i < offsets_[b + 1]; ++i) {
+                        visit(entries_[i]);
+                    }
+                }
+            }
+        }
+
+        template <typename F>
+        inline void WalkIndex::visit_box(size_t walker, double min_x, double min_y, double max_x, double max_y,
+                                         F &&visit) const {
+            if (entries_.empty()) {
+                return;
+            }
+
+            auto before = [](const Entry &entry, size_t w) { return entry.walker < w; };
+            auto after = [](size_t w, const Entry &entry) { return w < entry.walker; };
+            auto visit_range = [&](const Entry *first, const Entry *last) {
+                first = std::lower_bound(first, last, walker, before);
+                last = std::upper_bound(first, last, walker, after);
+                for (; first != last; ++first) {
+                    visit(*first);
+                }
+            };
+
+            int64_t cx0 = cell_coord(min_x), cx1 = cell_coord(max_x);
+            int64_t cy0 = cell_coord(min_y), cy1 = cell_coord(max_y);
+
+            double cells = (static_cast<double>(cx1) - cx0 + 1) * (static_cast<double>(cy1) - cy0 + 1);
+            if (cells > static_cast<double>(mask_ + 1)) {
+                for (size_t b = 0; b <= mask_; ++b) {
+                    visit_range(entries_.data() + offsets_[b], entries_.data() + offsets_[b + 1]);
+                }
+                return;
+            }
+
+            for (int64_t cy = cy0; cy <= cy1; ++cy) {
+                for (int64_t cx = cx0; cx <= cx1; ++cx) {
+                    size_t b = bucket(cx, cy);
+                    visit_range(entries_.data() + offsets_[b], entries_.data() + offsets_[b + 1]);
+                }
+            }
+        }
+
+        inline double WalkIndex::segment_distance_squared(const datapod::Point &p, const datapod::Point &a,
+                                                          const datapod::Point &b) {
+            double dx = b.x - a.x, dy = b.y - a.y;
+            double length_squared = dx * dx + dy * dy;
+            double t = length_squared > 0.0 ? ((p.x - a.x) * dx + (p.y - a.y) * dy) / length_squared : 0.0;
+            t = std::clamp(t, 0.0, 1.0);
+            double ex = a.x + t * dx - p.x, ey = a.y + t * dy - p.y;
+            return ex * ex + ey * ey;
+        }
+
+        // Liang-Barsky clip of the segment against the box
+        inline bool WalkIndex::segment_intersects_box(const datapod::Point &a, const datapod::Point &b, double min_x,
+                                                      double min_y, double max_x, double max_y) {
+            double t0 = 0.0, t1 = 1.0;
+            double d[2] = {b.x - a.x, b.y - a.y};
+            double lo[2] = {min_x - a.x, min_y - a.y};
+            double hi[2] = {max_x - a.x, max_y - a.y};
+
+            for (int axis = 0; axis < 2; ++axis) {
+                if (d[axis] == 0.0) {
+                    if (lo[axis] > 0.0 || hi[axis] < 0.0) {
+                        return false;
+                    }
+                    continue;
+                }
+                double ta = lo[axis] / d[axis], tb = hi[axis] / d[axis];
+                if (ta > tb) {
+                    std::swap(ta, tb);
+                }
+                t0 = std::max(t0, ta);
+                t1 = std::min(t1, tb);
+                if (t0 > t1) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        inline bool WalkIndex::segments_intersect(const datapod::Point &a, const datapod::Point &b,
+                                                  const datapod::Point &c, const datapod::Point &d) {
+            auto orient = [](const datapod::Point &p, const datapod::Point &q, const datapod::Point &r) {
+                double v = (q.x - p.x) * (r.y - p.y) - (q.y - p.y) * (r.x - p.x);
+                return (v > 0.0) - (v < 0.0);
+            };
+            // r lies on segment pq, given the three are collinear
+            auto on_segment = [](const datapod::Point &p, const datapod::Point &q, const datapod::Point &r) {
+                return std::min(p.x, q.x) <= r.x && r.x <= std::max(p.x, q.x) && std::min(p.y, q.y) <= r.y &&
+                       r.y <= std::max(p.y, q.y);
+            };
+
+            int o1 = orient(a, b, c), o2 = orient(a, b, d);
+            int o3 = orient(c, d, a), o4 = orient(c, d, b);
+
+            if (o1 != o2 && o3 != o4) {
+                return true;
+            }
+            return (o1 == 0 && on_segment(a, b, c)) || (o2 == 0 && on_segment(a, b, d)) ||
+                   (o3 == 0 && on_segment(c, d, a)) || (o4 == 0 && on_segment(c, d, b));
+        }
+
+        inline std::vector<WalkSegment> WalkIndex::sorted_unique(std::vector<WalkSegment> hits) {
+            std::sort(hits.begin(), hits.end());
+            hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+            return hits;
+        }
+
+    } // namespace path
+} // namespace entropy
@@ -0,0 +1,170 @@
+#include <doctest/doctest.h>
+#include <entropy/entropy.hpp>
+
+#include <cmath>
+#include <vector>
+
+using NoiseGen = entropy::noise::NoiseGen;
+
+namespace {
+
+    const NoiseGen::CellularDistanceFunction kDistanceFunctions[] = {
+        NoiseGen::CellularDistanceFunction_Euclidean, NoiseGen::CellularDistanceFunction_EuclideanSq,
+        NoiseGen::CellularDistanceFunction_Manhattan, NoiseGen::CellularDistanceFunction_Hybrid};
+
+    NoiseGen make_gen(NoiseGen::CellularDistanceFunction distanceFunction) {
+        NoiseGen gen(4242);
+        gen.SetNoiseType(NoiseGen::NoiseType_Cellular);
+        gen.SetFrequency(0.07f);
+        gen.SetCellularJitter(0.9f);
+        gen.SetCellularDistanceFunction(distanceFunction);
+        return gen;
+    }
+
+    // One query reproduces GetNoise for every return type built from F1, F2 and the cell value
+    bool matches_return_types(NoiseGen gen, float x, float y) {
+        NoiseGen::CellularResult r = gen.GetCellular(x, y);
+        bool same = true;
+        gen.SetCellularReturnType(NoiseGen::CellularReturnType_Distance);
+        same &= gen.GetNoise(x, y) == r.distance0 - 1;
+        gen.SetCellularReturnType(NoiseGen::CellularReturnType_Distance2);
+        same &= gen.GetNoise(x, y) == r.distance1 - 1;
+        gen.SetCellularReturnType(NoiseGen::CellularReturnType_Distance2Sub);
+        same &= gen.GetNoise(x, y) == r.distance1 - r.distance0 - 1;
+        gen.SetCellularReturnType(NoiseGen::CellularReturnType_CellValue);
+        same &= gen.GetNoise(x, y) == r.cellValue;
+        return same;
+    }
+
+    bool matches_return_types(NoiseGen gen, float x, float y, float z) {
+        NoiseGen::CellularResult r = gen.GetCellular(x, y, z);
+        bool same = true;
+        gen.SetCellularReturnType(NoiseGen::CellularReturnType_Distance);
+        same &= gen.GetNoise(x, y, z) == r.distance0 - 1;
+        gen.SetCellularReturnType(NoiseGen::CellularReturnType_Distance2);
+        same &= gen.GetNoise(x, y, z) == r.distance1 - 1;
+        gen.SetCellularReturnType(NoiseGen::CellularReturnType_Distance2Sub);
+        same &= gen.GetNoise(x, y, z) == r.distance1 - r.distance0 - 1;
+        gen.SetCellularReturnType(NoiseGen::CellularReturnType_CellValue);
+        same &= gen.GetNoise(x, y, z) == r.cellValue;
+        return same;
+    }
+
+} // namespace
+
+TEST_CASE("Cellular query matches GetNoise return types") {
+    for (auto distanceFunction : kDistanceFunctions) {
+        NoiseGen gen = make_gen(distanceFunction);
+        NoiseGen rotated = gen;
+        rotated.SetRotationType3D(NoiseGen::RotationType3D_ImproveXZPlanes);
+        NoiseGen periodic = gen;
+        periodic.SetPeriod(5, 7, 3);
+
+        bool same = true;
+        for (int i = 0; i < 200; ++i) {
+            float x = i * 1.37f - 90.0f, y = i * -0.83f + 20.0f, z = i * 0.51f;
+            same &= matches_return_types(gen, x, y);
+            same &= matches_return_types(gen, x, y, z);
+            same &= matches_return_types(rotated, x, y, z);
+            same &= matches_return_types(periodic, x, y);
+            same &= matches_return_types(periodic, x, y, z);
+        }
+        CHECK(same);
+    }
+}
+
+TEST_CASE("Cellular query finds the nearest feature point") {
+    NoiseGen gen = make_gen(NoiseGen::CellularDistanceFunction_Euclidean);
+    NoiseGen rotated = gen;
+    rotated.SetRotationType3D(NoiseGen::RotationType3D_ImproveXYPlanes);
+
+    bool onPoint = true, closer = true;
+    for (int i = 0; i < 100; ++i) {
+        float x = i * 2.9f - 140.0f, y = i * 1.1f, z = i * -0.7f + 3.0f;
+
+        // Querying at the returned point lands on that point's own cell, at (nearly) zero distance
+        NoiseGen::CellularResult r2 = gen.GetCellular(x, y);
+        NoiseGen::CellularResult at2 = gen.GetCellular(r2.pointX, r2.pointY);
+        onPoint &= at2.distance0 < 1e-3f && at2.cellValue == r2.cellValue && r2.pointZ == 0;
+        // F1 in input units is the frequency scaled distance to the point
+        closer &= std::fabs(std::hypot(r2.pointX - x, r2.pointY - y) * 0.07f - r2.distance0) < 1e-4f;
+
+        for (const NoiseGen &g : {gen, rotated}) {
+            NoiseGen::CellularResult r3 = g.GetCellular(x, y, z);
+            NoiseGen::CellularResult at3 = g.GetCellular(r3.pointX, r3.pointY, r3.pointZ);
+            onPoint &= at3.distance0 < 1e-3f && at3.cellValue == r3.cellValue;
+            float dx = r3.pointX - x, dy = r3.pointY - y, dz = r3.pointZ - z;
+            closer &= std::fabs(std::sqrt(dx * dx + dy * dy + dz * dz) * 0.07f - r3.distance0) < 1e-4f;
+        }
+    }
+    CHECK(onPoint);
+    CHECK(closer);
+}
+
+TEST_CASE("Cellular query depends on the rotation type, not the noise type") {
+    NoiseGen gen = make_gen(NoiseGen::CellularDistanceFunction_Euclidean);
+    NoiseGen rotated = gen;
+    rotated.SetRotationType3D(NoiseGen::RotationType3D_ImproveXYPlanes);
+
+    auto same = [](const NoiseGen::CellularResult &a, const NoiseGen::CellularResult &b) {
+        return a.distance0 == b.distance0 && a.distance1 == b.distance1 && a.cellValue == b.cellValue &&
+               a.pointX == b.pointX && a.pointY == b.pointY && a.pointZ == b.pointZ;
+    };
+
+    bool unchanged = true;
+    for (auto noiseType : {NoiseGen::NoiseType_OpenSimplex2, NoiseGen::NoiseType_OpenSimplex2S,
+                           NoiseGen::NoiseType_Perlin}) {
+        NoiseGen other = gen;
+        other.SetNoiseType(noiseType);
+        NoiseGen otherRotated = rotated;
+        otherRotated.SetNoiseType(noiseType);
+
+        for (int i = 0; i < 100; ++i) {
+            float x = i * 1.9f - 70.0f, y = i * 0.4f, z = i * -1.3f + 11.0f;
+            unchanged &= same(other.GetCellular(x, y, z), gen.GetCellular(x, y, z));
+            unchanged &= same(otherRotated.GetCellular(x, y, z), rotated.GetCellular(x, y, z));
+        }
+    }
+    CHECK(unchanged);
+}
+
+TEST_CASE("Cellular query batch and grid loops match GetCellular") {
+    NoiseGen gen = make_gen(NoiseGen::CellularDistanceFunction_Hybrid);
+
+    auto same = [](const NoiseGen::CellularResult &a, const NoiseGen::CellularResult &b) {
+        return a.distance0 == b.distance0 && a.distance1 == b.distance1 && a.cellValue == b.cellValue &&
+               a.pointX == b.pointX && a.pointY == b.pointY && a.pointZ == b.pointZ;
+    };
+
+    const int w = 13, h = 7, d = 3;
+    const float x0 = -4.5f, y0 = 8.25f, z0 = 1.0f, step = 0.75f;
+    std::vector<NoiseGen::CellularResult> grid2(w * h), grid3(w * h * d);
+    gen.GenUniformGridCellular2D(grid2.data(), x0, y0, w, h, step);
+    gen.GenUniformGridCellular3D(grid3.data(), x0, y0, z0, w, h, d, step);
+
+    bool gridsMatch = true;
+    for (int iz = 0; iz < d; ++iz) {
+        for (int iy = 0; iy < h; ++iy) {
+            for (int ix = 0; ix < w; ++ix) {
+                float x = x0 + ix * step, y = y0 + iy * step, z = z0 + iz * step;
+                gridsMatch &= same(grid3[(iz * h + iy) * w + ix], gen.GetCellular(x, y, z));
+                if (iz == 0) {
+                    gridsMatch &= same(grid2[iy * w + ix], gen.GetCellular(x, y));
+                }
+            }
+        }
+    }
+    CHECK(gridsMatch);
+
+    std::vector<float> xs = {0.5f, -300.0f, 12.0f}, ys = {2.0f, 7.5f, -1.0f}, zs = {9.0f, 0.0f, 4.25f};
+    std::vector<NoiseGen::CellularResult> out2(xs.size()), out3(xs.size());
+    gen.GetCellularBatch(xs.data(), ys.data(), out2.data(), xs.size());
+    gen.GetCellularBatch(xs.data(), ys.data(), zs.data(), out3.data(), xs.size());
+
+    bool batchesMatch = true;
+    for (size_t i = 0; i < xs.size(); ++i) {
+        batchesMatch &= same(out2[i], gen.GetCellular(xs[i], ys[i]));
+        batchesMatch &= same(out3[i], gen.GetCellular(xs[i], ys[i], zs[i]));
+    }
+    CHECK(batchesMatch);
+}
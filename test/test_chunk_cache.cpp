@@ -0,0 +1,164 @@
+#include <doctest/doctest.h>
+#include <entropy/entropy.hpp>
+#include <vector>
+
+using NoiseGen = entropy::noise::NoiseGen;
+using ChunkCache = entropy::noise::ChunkCache;
+
+TEST_CASE("NoiseGen config hash") {
+    NoiseGen a(1337);
+    NoiseGen b(1337);
+    CHECK(a.GetConfigHash() == b.GetConfigHash());
+
+    b.SetSeed(1338);
+    CHECK(a.GetConfigHash() != b.GetConfigHash());
+    b.SetSeed(1337);
+    CHECK(a.GetConfigHash() == b.GetConfigHash());
+
+    b.SetFrequency(0.02f);
+    CHECK(a.GetConfigHash() != b.GetConfigHash());
+    b.SetFrequency(0.01f);
+    CHECK(a.GetConfigHash() == b.GetConfigHash());
+
+    b.SetFractalType(NoiseGen::FractalType_FBm);
+    CHECK(a.GetConfigHash() != b.GetConfigHash());
+    a.SetFractalType(NoiseGen::FractalType_FBm);
+    CHECK(a.GetConfigHash() == b.GetConfigHash());
+
+    b.SetFractalOctaves(5);
+    CHECK(a.GetConfigHash() != b.GetConfigHash());
+}
+
+TEST_CASE("ChunkCache chunks match GenUniformGrid") {
+    NoiseGen gen(99);
+    gen.SetFractalType(NoiseGen::FractalType_FBm);
+    gen.SetFrequency(0.03f);
+
+    ChunkCache cache(16, 0.5f, 8);
+
+    SUBCASE("2D") {
+        ChunkCache::Chunk chunk = cache.GetChunk2D(gen, -3, 2);
+        std::vector<float> expected(16 * 16);
+        gen.GenUniformGrid2D(expected.data(), -3 * 8.0f, 2 * 8.0f, 16, 16, 0.5f);
+        REQUIRE(chunk->size() == expected.size());
+        CHECK(*chunk == expected);
+    }
+
+    SUBCASE("3D") {
+        ChunkCache::Chunk chunk = cache.GetChunk3D(gen, 1, -1, 4);
+        std::vector<float> expected(16 * 16 * 16);
+        gen.GenUniformGrid3D(expected.data(), 8.0f, -8.0f, 32.0f, 16, 16, 16, 0.5f);
+        REQUIRE(chunk->size() == expected.size());
+        CHECK(*chunk == expected);
+    }
+}
+
+TEST_CASE("ChunkCache hits, misses and LRU eviction") {
+    NoiseGen gen(7);
+    ChunkCache cache(8, 1.0f, 3);
+
+    ChunkCache::Chunk first = cache.GetChunk2D(gen, 0, 0);
+    CHECK(cache.GetMisses() == 1);
+    CHECK(cache.GetChunk2D(gen, 0, 0) == first);
+    CHECK(cache.GetHits() == 1);
+
+    cache.GetChunk2D(gen, 1, 0);
+    cache.GetChunk2D(gen, 2, 0);
+    CHECK(cache.GetSize() == 3);
+
+    // (0, 0) was used before (1, 0) and (2, 0), but touching it makes (1, 0) the oldest
+    cache.GetChunk2D(gen, 0, 0);
+    cache.GetChunk2D(gen, 3, 0);
+    CHECK(cache.GetSize() == 3);
+    CHECK(cache.Contains2D(gen, 0, 0));
+    CHECK_FALSE(cache.Contains2D(gen, 1, 0));
+    CHECK(cache.Contains2D(gen, 2, 0));
+    CHECK(cache.Contains2D(gen, 3, 0));
+
+    // Evicted chunks stay valid for holders
+    CHECK(first->size() == 64);
+
+    // 2D and 3D chunks at the same coordinates are distinct
+    CHECK_FALSE(cache.Contains3D(gen, 0, 0, 0));
+
+    cache.SetCapacity(1);
+    CHECK(cache.GetSize() == 1);
+    CHECK(cache.Contains2D(gen, 3, 0));
+
+    cache.Clear();
+    CHECK(cache.GetSize() == 0);
+    CHECK(cache.GetHits() == 0);
+    CHECK(cache.GetMisses() == 0);
+}
+
+TEST_CASE("ChunkCache keys on the noise configuration") {
+    NoiseGen gen(7);
+    ChunkCache cache(8, 1.0f, 16);
+
+    ChunkCache::Chunk before = cache.GetChunk2D(gen, 0, 0);
+    gen.SetSeed(8);
+    CHECK_FALSE(cache.Contains2D(gen, 0, 0));
+    ChunkCache::Chunk after = cache.GetChunk2D(gen, 0, 0);
+    CHECK(*before != *after);
+
+    gen.SetSeed(7);
+    CHECK(cache.GetChunk2D(gen, 0, 0) == before);
+}
+
+TEST_CASE("ChunkCache prefetch") {
+    NoiseGen gen(5);
+
+    for (size_t threads : {1, 4}) {
+        ChunkCache cache(8, 1.0f, 64, threads);
+
+        cache.Prefetch2D(gen, 10, -4, 1);
+        CHECK(cache.GetSize() == 9);
+        CHECK(cache.GetMisses() == 0);
+
+        bool all = true;
+        for (int y = -5; y <= -3; ++y) {
+            for (int x = 9; x <= 11; ++x) {
+                all = all && cache.Contains2D(gen, x, y);
+            }
+        }
+        CHECK(all);
+
+        // Prefetched chunks are served as hits and match on-demand generation
+        ChunkCache fresh(8, 1.0f, 4);
+        CHECK(*cache.GetChunk2D(gen, 11, -5) == *fresh.GetChunk2D(gen, 11, -5));
+        CHECK(cache.GetHits() == 1);
+
+        cache.Prefetch3D(gen, 0, 0, 0, 1);
+        CHECK(cache.GetSize() == 9 + 27);
+        CHECK(*cache.GetChunk3D(gen, -1, 1, 0) == *fresh.GetChunk3D(gen, -1, 1, 0));
+    }
+
+    SUBCASE("Neighbourhood larger than capacity keeps the nearest chunks") {
+        ChunkCache cache(4, 1.0f, 5);
+        cache.Prefetch2D(gen, 0, 0, 2);
+        CHECK(cache.GetSize() == 5);
+        CHECK(cache.Contains2D(gen, 0, 0));
+    }
+}
+
+TEST_CASE("ChunkCache prefetch keeps cached chunks in range") {
+    NoiseGen gen(5);
+    ChunkCache cache(8, 1.0f, 9);
+
+    // (0, 0) is the least recently used entry once the far chunks are in, so inserting the missing
+    // neighbours must not evict it before it is refreshed
+    cache.GetChunk2D(gen, 0, 0);
+    for (int i = 0; i < 8; ++i) {
+        cache.GetChunk2D(gen, 100 + i, 100);
+    }
+    cache.Prefetch2D(gen, 0, 0, 1);
+
+    CHECK(cache.GetSize() == 9);
+    bool all = true;
+    for (int y = -1; y <= 1; ++y) {
+        for (int x = -1; x <= 1; ++x) {
+            all = all && cache.Contains2D(gen, x, y);
+        }
+    }
+    CHECK(all);
+}
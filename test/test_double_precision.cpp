@@ -0,0 +1,84 @@
+#include <doctest/doctest.h>
+#include <entropy/entropy.hpp>
+
+#include <cmath>
+#include <set>
+
+using NoiseGen = entropy::noise::NoiseGen;
+
+namespace {
+
+    const NoiseGen::NoiseType kNoiseTypes[] = {NoiseGen::NoiseType_OpenSimplex2, NoiseGen::NoiseType_OpenSimplex2S,
+                                               NoiseGen::NoiseType_Cellular,     NoiseGen::NoiseType_Perlin,
+                                               NoiseGen::NoiseType_ValueCubic,   NoiseGen::NoiseType_Value};
+
+    const NoiseGen::FractalType kFractalTypes[] = {NoiseGen::FractalType_None, NoiseGen::FractalType_FBm,
+                                                   NoiseGen::FractalType_Ridged, NoiseGen::FractalType_PingPong};
+
+} // namespace
+
+TEST_CASE("GetNoiseDouble agrees with GetNoise near the origin") {
+    for (NoiseGen::NoiseType noise : kNoiseTypes) {
+        for (NoiseGen::FractalType fractal : kFractalTypes) {
+            NoiseGen gen(31337);
+            gen.SetNoiseType(noise);
+            gen.SetFractalType(fractal);
+            gen.SetFrequency(0.05f);
+
+            // Only the float rounding of the transform differs (amplified by higher octaves), cellular values can
+            // jump where two feature points tie
+            int agree = 0;
+            for (int i = 0; i < 200; ++i) {
+                float x = i * 0.75f - 60.0f;
+                float y = i * -0.5f + 20.0f;
+                float z = i * 0.25f;
+                agree += std::fabs(gen.GetNoiseDouble(x, y) - gen.GetNoise(x, y)) < 5e-3f &&
+                         std::fabs(gen.GetNoiseDouble(x, y, z) - gen.GetNoise(x, y, z)) < 5e-3f;
+            }
+            CHECK(agree >= 198);
+        }
+    }
+}
+
+TEST_CASE("GetNoiseDouble keeps detail far from the origin") {
+    NoiseGen gen(7);
+    gen.SetNoiseType(NoiseGen::NoiseType_Perlin);
+    gen.SetFractalType(NoiseGen::FractalType_FBm);
+
+    // At 1e9 floats are 64 units apart, so a 0.5 unit sweep collapses to a couple of values
+    std::set<float> precise, narrowed;
+    for (int i = 0; i < 200; ++i) {
+        double x = 1e9 + i * 0.5;
+        precise.insert(gen.GetNoiseDouble(x, 12345.0));
+        narrowed.insert(gen.GetNoise(static_cast<float>(x), 12345.0f));
+    }
+    CHECK(precise.size() > 190);
+    CHECK(narrowed.size() < 5);
+
+    // Neighbouring samples stay continuous
+    bool smooth = true;
+    for (int i = 0; i < 200; ++i) {
+        double x = 1e9 + i * 0.01;
+        smooth &= std::fabs(gen.GetNoiseDouble(x, 0.0, 0.0) - gen.GetNoiseDouble(x + 0.01, 0.0, 0.0)) < 0.01f;
+    }
+    CHECK(smooth);
+}
+
+TEST_CASE("GetNoiseDouble selects the exact lattice cell") {
+    NoiseGen gen(99);
+    gen.SetNoiseType(NoiseGen::NoiseType_Value);
+    gen.SetFrequency(1.0f);
+
+    // Integers around 2^23 are exact in float, quarter offsets are not
+    const float cell = 8388610.0f;
+    float a = gen.GetNoise(cell, 0.0f);
+    float b = gen.GetNoise(cell + 1.0f, 0.0f);
+    CHECK(gen.GetNoiseDouble(cell, 0.0) == a);
+    CHECK(gen.GetNoiseDouble(cell + 1.0, 0.0) == b);
+
+    // Value noise on a lattice row is the hermite blend of its two cell values
+    float t = 0.25f;
+    float expected = a + t * t * (3 - 2 * t) * (b - a);
+    CHECK(std::fabs(gen.GetNoiseDouble(cell + 0.25, 0.0) - expected) < 1e-6f);
+    CHECK(gen.GetNoise(cell + 0.25f, 0.0f) == a);
+}
@@ -0,0 +1,224 @@
+#include <doctest/doctest.h>
+#include <entropy/entropy.hpp>
+
+#include <cmath>
+
+using NoiseGen = entropy::noise::NoiseGen;
+
+namespace {
+
+    const NoiseGen::NoiseType kNoiseTypes[] = {NoiseGen::NoiseType_OpenSimplex2, NoiseGen::NoiseType_OpenSimplex2S,
+                                               NoiseGen::NoiseType_Cellular,     NoiseGen::NoiseType_Perlin,
+                                               NoiseGen::NoiseType_ValueCubic,   NoiseGen::NoiseType_Value};
+
+    const NoiseGen::FractalType kFractalTypes[] = {NoiseGen::FractalType_None, NoiseGen::FractalType_FBm,
+                                                   NoiseGen::FractalType_Ridged, NoiseGen::FractalType_PingPong};
+
+    NoiseGen make_gen(NoiseGen::NoiseType noise, NoiseGen::FractalType fractal) {
+        NoiseGen gen(4242);
+        gen.SetNoiseType(noise);
+        gen.SetFractalType(fractal);
+        gen.SetFrequency(0.05f);
+        gen.SetFractalOctaves(3);
+        gen.SetFractalWeightedStrength(0.4f);
+        return gen;
+    }
+
+    bool close(float analytic, float numeric) {
+        return std::fabs(analytic - numeric) <= 2e-3f + 0.02f * std::fabs(numeric);
+    }
+
+    // Central difference of GetNoise along one axis
+    template <typename F> float central_difference(F f, float h) { return (f(h) - f(-h)) / (2 * h); }
+
+    // Number of samples whose analytic gradient matches the central difference
+    struct Agreement {
+        int matched = 0;
+        int total = 0;
+    };
+
+    Agreement check_2d(const NoiseGen &gen) {
+        Agreement result;
+        const float h = 0.01f;
+        for (int i = 0; i < 300; ++i) {
+            float x = i * 0.37f - 55.0f;
+            float y = i * -0.23f + 31.0f;
+
+            float dx, dy;
+            gen.GetNoiseWithGradient(x, y, dx, dy);
+
+            float fx = central_difference([&](float o) { return gen.GetNoise(x + o, y); }, h);
+            float fy = central_difference([&](float o) { return gen.GetNoise(x, y + o); }, h);
+
+            ++result.total;
+            result.matched += close(dx, fx) && close(dy, fy);
+        }
+        return result;
+    }
+
+    Agreement check_3d(const NoiseGen &gen) {
+        Agreement result;
+        const float h = 0.01f;
+        for (int i = 0; i < 300; ++i) {
+            float x = i * 0.37f - 55.0f;
+            float y = i * -0.23f + 31.0f;
+            float z = i * 0.11f - 7.0f;
+
+            float dx, dy, dz;
+            gen.GetNoiseWithGradient(x, y, z, dx, dy, dz);
+
+            float fx = central_difference([&](float o) { return gen.GetNoise(x + o, y, z); }, h);
+            float fy = central_difference([&](float o) { return gen.GetNoise(x, y + o, z); }, h);
+            float fz = central_difference([&](float o) { return gen.GetNoise(x, y, z + o); }, h);
+
+            ++result.total;
+            result.matched += close(dx, fx) && close(dy, fy) && close(dz, fz);
+        }
+        return result;
+    }
+
+} // namespace
+
+TEST_CASE("GetNoiseWithGradient value matches GetNoise") {
+    const NoiseGen::RotationType3D rotations[] = {NoiseGen::RotationType3D_None,
+                                                  NoiseGen::RotationType3D_ImproveXYPlanes,
+                                                  NoiseGen::RotationType3D_ImproveXZPlanes};
+
+    for (NoiseGen::NoiseType noise : kNoiseTypes) {
+        for (NoiseGen::FractalType fractal : kFractalTypes) {
+            for (NoiseGen::RotationType3D rotation : rotations) {
+                NoiseGen gen = make_gen(noise, fractal);
+                gen.SetRotationType3D(rotation);
+
+                bool same = true;
+                for (int i = 0; i < 200; ++i) {
+                    float x = i * 3.7f - 300.0f;
+                    float y = i * -1.3f + 50.0f;
+                    float z = i * 0.9f;
+                    float dx, dy, dz;
+                    same &= gen.GetNoiseWithGradient(x, y, dx, dy) == gen.GetNoise(x, y);
+                    same &= gen.GetNoiseWithGradient(x, y, z, dx, dy, dz) == gen.GetNoise(x, y, z);
+                }
+                CHECK(same);
+            }
+        }
+    }
+}
+
+TEST_CASE("GetNoiseWithGradient matches finite differences") {
+    SUBCASE("Smooth noise, single and FBm") {
+        const NoiseGen::NoiseType noises[] = {NoiseGen::NoiseType_Perlin, NoiseGen::NoiseType_ValueCubic,
+                                              NoiseGen::NoiseType_Value};
+        const NoiseGen::FractalType fractals[] = {NoiseGen::FractalType_None, NoiseGen::FractalType_FBm};
+        for (NoiseGen::NoiseType noise : noises) {
+            for (NoiseGen::FractalType fractal : fractals) {
+                Agreement a2 = check_2d(make_gen(noise, fractal));
+                Agreement a3 = check_3d(make_gen(noise, fractal));
+                CHECK(a2.matched == a2.total);
+                CHECK(a3.matched == a3.total);
+            }
+        }
+    }
+
+    SUBCASE("2D simplex, single and FBm") {
+        const NoiseGen::NoiseType noises[] = {NoiseGen::NoiseType_OpenSimplex2, NoiseGen::NoiseType_OpenSimplex2S};
+        const NoiseGen::FractalType fractals[] = {NoiseGen::FractalType_None, NoiseGen::FractalType_FBm};
+        for (NoiseGen::NoiseType noise : noises) {
+            for (NoiseGen::FractalType fractal : fractals) {
+                Agreement a2 = check_2d(make_gen(noise, fractal));
+                CHECK(a2.matched == a2.total);
+            }
+        }
+    }
+
+    // Cellular edges, ridges and ping-pong folds are creases, and the 3D OpenSimplex2/2S lattices have tiny
+    // value steps of their own, so a few samples are allowed to disagree with the finite difference
+    SUBCASE("Every noise and fractal type") {
+        for (NoiseGen::NoiseType noise : kNoiseTypes) {
+            for (NoiseGen::FractalType fractal : kFractalTypes) {
+                Agreement a2 = check_2d(make_gen(noise, fractal));
+                Agreement a3 = check_3d(make_gen(noise, fractal));
+                CHECK(a2.matched >= a2.total * 9 / 10);
+                CHECK(a3.matched >= a3.total * 9 / 10);
+            }
+        }
+    }
+
+    SUBCASE("3D rotation types") {
+        const NoiseGen::RotationType3D rotations[] = {NoiseGen::RotationType3D_ImproveXYPlanes,
+                                                      NoiseGen::RotationType3D_ImproveXZPlanes};
+        for (NoiseGen::RotationType3D rotation : rotations) {
+            for (NoiseGen::NoiseType noise : kNoiseTypes) {
+                NoiseGen gen = make_gen(noise, NoiseGen::FractalType_FBm);
+                gen.SetRotationType3D(rotation);
+                Agreement a3 = check_3d(gen);
+                CHECK(a3.matched >= a3.total * 9 / 10);
+            }
+        }
+    }
+}
+
+TEST_CASE("GetNoiseWithGradient scales with frequency") {
+    NoiseGen gen = make_gen(NoiseGen::NoiseType_Perlin, NoiseGen::FractalType_None);
+    float dx1, dy1, dx2, dy2;
+    gen.GetNoiseWithGradient(12.3f, -4.5f, dx1, dy1);
+
+    // Sampling the same noise-space point at twice the frequency doubles the slope
+    gen.SetFrequency(0.1f);
+    gen.GetNoiseWithGradient(12.3f * 0.5f, -4.5f * 0.5f, dx2, dy2);
+    CHECK(close(dx2, dx1 * 2));
+    CHECK(close(dy2, dy1 * 2));
+}
+
+TEST_CASE("GetNoiseWithGradient stays finite far from the origin") {
+    bool finite = true;
+    bool cellularSlopes = false;
+    for (NoiseGen::NoiseType noise : kNoiseTypes) {
+        for (NoiseGen::FractalType fractal : kFractalTypes) {
+            NoiseGen gen = make_gen(noise, fractal);
+            for (float frequency : {1.0f, 0.01f}) {
+                gen.SetFrequency(frequency);
+                float far = frequency == 1.0f ? 40000.3f : 4e6f;
+                for (int i = 0; i < 16; ++i) {
+                    float x = far + i * 0.37f, y = 12.7f + i * 1.3f, z = -far + i * 0.91f;
+                    float dx, dy, dz;
+                    float v2 = gen.GetNoiseWithGradient(x, y, dx, dy);
+                    finite &= std::isfinite(v2) && std::isfinite(dx) && std::isfinite(dy);
+                    cellularSlopes |= noise == NoiseGen::NoiseType_Cellular && (dx != 0 || dy != 0);
+                    float v3 = gen.GetNoiseWithGradient(x, y, z, dx, dy, dz);
+                    finite &= std::isfinite(v3) && std::isfinite(dx) && std::isfinite(dy) && std::isfinite(dz);
+                }
+            }
+        }
+    }
+    CHECK(finite);
+    CHECK(cellularSlopes);
+}
+
+TEST_CASE("GetNoiseWithGradient in periodic mode") {
+    const NoiseGen::NoiseType noises[] = {NoiseGen::NoiseType_OpenSimplex2, NoiseGen::NoiseType_Cellular,
+                                          NoiseGen::NoiseType_Perlin, NoiseGen::NoiseType_ValueCubic,
+                                          NoiseGen::NoiseType_Value};
+    for (NoiseGen::NoiseType noise : noises) {
+        for (NoiseGen::FractalType fractal : kFractalTypes) {
+            NoiseGen gen = make_gen(noise, fractal);
+            gen.SetPeriod(8, 8, 4);
+
+            bool same = true;
+            for (int i = 0; i < 200; ++i) {
+                float x = i * 3.7f - 300.0f + 0.7f;
+                float y = i * -1.3f + 50.0f;
+                float z = i * 0.9f;
+                float dx, dy, dz;
+                same &= gen.GetNoiseWithGradient(x, y, dx, dy) == gen.GetNoise(x, y);
+                same &= gen.GetNoiseWithGradient(x, y, z, dx, dy, dz) == gen.GetNoise(x, y, z);
+            }
+            CHECK(same);
+
+            Agreement a2 = check_2d(gen);
+            Agreement a3 = check_3d(gen);
+            CHECK(a2.matched >= a2.total * 9 / 10);
+            CHECK(a3.matched >= a3.total * 9 / 10);
+        }
+    }
+}
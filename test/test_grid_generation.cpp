@@ -0,0 +1,366 @@
+#include <doctest/doctest.h>
+#include <entropy/entropy.hpp>
+#include <vector>
+
+using NoiseGen = entropy::noise::NoiseGen;
+
+namespace {
+
+    const NoiseGen::NoiseType kNoiseTypes[] = {NoiseGen::NoiseType_OpenSimplex2, NoiseGen::NoiseType_OpenSimplex2S,
+                                               NoiseGen::NoiseType_Cellular,     NoiseGen::NoiseType_Perlin,
+                                               NoiseGen::NoiseType_ValueCubic,   NoiseGen::NoiseType_Value};
+
+    const NoiseGen::FractalType kFractalTypes[] = {NoiseGen::FractalType_None, NoiseGen::FractalType_FBm,
+                                                   NoiseGen::FractalType_Ridged, NoiseGen::FractalType_PingPong};
+
+    bool grid2d_matches_scalar(const NoiseGen &gen, float x0, float y0, int w, int h, float step) {
+        std::vector<float> grid(w * h);
+        gen.GenUniformGrid2D(grid.data(), x0, y0, w, h, step);
+
+        for (int iy = 0; iy < h; ++iy) {
+            for (int ix = 0; ix < w; ++ix) {
+                if (grid[iy * w + ix] != gen.GetNoise(x0 + ix * step, y0 + iy * step)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool grid3d_matches_scalar(const NoiseGen &gen, float x0, float y0, float z0, int w, int h, int d, float step) {
+        std::vector<float> grid(w * h * d);
+        gen.GenUniformGrid3D(grid.data(), x0, y0, z0, w, h, d, step);
+
+        for (int iz = 0; iz < d; ++iz) {
+            for (int iy = 0; iy < h; ++iy) {
+                for (int ix = 0; ix < w; ++ix) {
+                    float expected = gen.GetNoise(x0 + ix * step, y0 + iy * step, z0 + iz * step);
+                    if (grid[(iz * h + iy) * w + ix] != expected) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+TEST_CASE("Uniform grid generation matches GetNoise") {
+    NoiseGen gen(1337);
+    gen.SetFrequency(0.05f);
+
+    SUBCASE("2D grid for every noise and fractal type") {
+        for (auto noiseType : kNoiseTypes) {
+            for (auto fractalType : kFractalTypes) {
+                gen.SetNoiseType(noiseType);
+                gen.SetFractalType(fractalType);
+                CHECK(grid2d_matches_scalar(gen, -13.5f, 7.25f, 97, 9, 0.75f));
+            }
+        }
+    }
+
+    SUBCASE("3D grid for every noise and fractal type") {
+        for (auto noiseType : kNoiseTypes) {
+            for (auto fractalType : kFractalTypes) {
+                gen.SetNoiseType(noiseType);
+                gen.SetFractalType(fractalType);
+                CHECK(grid3d_matches_scalar(gen, 3.0f, -5.5f, 11.0f, 70, 4, 3, 1.25f));
+            }
+        }
+    }
+
+    SUBCASE("3D grid honours rotation types") {
+        gen.SetNoiseType(NoiseGen::NoiseType_Perlin);
+        gen.SetRotationType3D(NoiseGen::RotationType3D_ImproveXYPlanes);
+        CHECK(grid3d_matches_scalar(gen, 0.0f, 0.0f, 0.0f, 16, 8, 4, 2.0f));
+
+        gen.SetRotationType3D(NoiseGen::RotationType3D_ImproveXZPlanes);
+        CHECK(grid3d_matches_scalar(gen, 0.0f, 0.0f, 0.0f, 16, 8, 4, 2.0f));
+    }
+
+    SUBCASE("Weighted fractal settings") {
+        gen.SetNoiseType(NoiseGen::NoiseType_OpenSimplex2);
+        gen.SetFractalType(NoiseGen::FractalType_FBm);
+        gen.SetFractalOctaves(6);
+        gen.SetFractalWeightedStrength(0.7f);
+        gen.SetFractalGain(0.6f);
+        gen.SetFractalLacunarity(2.3f);
+        CHECK(grid2d_matches_scalar(gen, 100.0f, -100.0f, 33, 33, 3.0f));
+        CHECK(grid3d_matches_scalar(gen, 100.0f, -100.0f, 50.0f, 17, 5, 5, 3.0f));
+    }
+}
+
+TEST_CASE("Vectorized OpenSimplex2 grid matches GetNoise") {
+    // Runs every SIMD level this CPU supports across lattice sign changes and partial tails
+    const NoiseGen::SimdLevel detected = NoiseGen::GetSimdLevel();
+    const NoiseGen::SimdLevel levels[] = {NoiseGen::SimdLevel_Scalar, NoiseGen::SimdLevel_SSE41,
+                                          NoiseGen::SimdLevel_AVX2, NoiseGen::SimdLevel_AVX512,
+                                          NoiseGen::SimdLevel_NEON};
+
+    NoiseGen gen(-91);
+    gen.SetNoiseType(NoiseGen::NoiseType_OpenSimplex2);
+    gen.SetFrequency(0.37f);
+
+    for (auto level : levels) {
+        if (!NoiseGen::SetSimdLevel(level)) {
+            continue;
+        }
+        CHECK(NoiseGen::GetSimdLevel() == level);
+
+        gen.SetFractalType(NoiseGen::FractalType_None);
+        for (int w = 1; w <= 35; ++w) {
+            CHECK(grid2d_matches_scalar(gen, -3.3f, -2.9f, w, 3, 0.61f));
+        }
+
+        gen.SetFractalType(NoiseGen::FractalType_FBm);
+        gen.SetFractalOctaves(6);
+        CHECK(grid2d_matches_scalar(gen, -40000.0f, 25000.0f, 131, 7, 13.7f));
+    }
+
+    CHECK(NoiseGen::SetSimdLevel(detected));
+}
+
+TEST_CASE("Vectorized cellular grid matches GetNoise") {
+    const NoiseGen::SimdLevel detected = NoiseGen::GetSimdLevel();
+    const NoiseGen::SimdLevel levels[] = {NoiseGen::SimdLevel_Scalar, NoiseGen::SimdLevel_SSE41,
+                                          NoiseGen::SimdLevel_AVX2, NoiseGen::SimdLevel_AVX512,
+                                          NoiseGen::SimdLevel_NEON};
+    const NoiseGen::CellularDistanceFunction distanceFunctions[] = {
+        NoiseGen::CellularDistanceFunction_Euclidean, NoiseGen::CellularDistanceFunction_EuclideanSq,
+        NoiseGen::CellularDistanceFunction_Manhattan, NoiseGen::CellularDistanceFunction_Hybrid};
+    const NoiseGen::CellularReturnType returnTypes[] = {
+        NoiseGen::CellularReturnType_CellValue,    NoiseGen::CellularReturnType_Distance,
+        NoiseGen::CellularReturnType_Distance2,    NoiseGen::CellularReturnType_Distance2Add,
+        NoiseGen::CellularReturnType_Distance2Sub, NoiseGen::CellularReturnType_Distance2Mul,
+        NoiseGen::CellularReturnType_Distance2Div};
+
+    NoiseGen gen(2024);
+    gen.SetNoiseType(NoiseGen::NoiseType_Cellular);
+    gen.SetFrequency(0.21f);
+    gen.SetCellularJitter(0.85f);
+
+    for (auto level : levels) {
+        if (!NoiseGen::SetSimdLevel(level)) {
+            continue;
+        }
+        for (auto distanceFunction : distanceFunctions) {
+            for (auto returnType : returnTypes) {
+                gen.SetCellularDistanceFunction(distanceFunction);
+                gen.SetCellularReturnType(returnType);
+                CHECK(grid2d_matches_scalar(gen, -7.7f, -3.1f, 21, 5, 0.9f));
+                CHECK(grid3d_matches_scalar(gen, -2.2f, 4.4f, -6.6f, 19, 3, 3, 0.8f));
+            }
+        }
+    }
+
+    CHECK(NoiseGen::SetSimdLevel(detected));
+}
+
+TEST_CASE("Lattice-coherent grids match GetNoise") {
+    // Low frequency puts long runs of samples in one lattice cell, the origins straddle cells at zero
+    const NoiseGen::NoiseType noises[] = {NoiseGen::NoiseType_Perlin, NoiseGen::NoiseType_ValueCubic,
+                                          NoiseGen::NoiseType_Value};
+
+    NoiseGen gen(-404);
+    gen.SetFrequency(0.01f);
+
+    for (auto noiseType : noises) {
+        for (auto fractalType : kFractalTypes) {
+            gen.SetNoiseType(noiseType);
+            gen.SetFractalType(fractalType);
+            CHECK(grid2d_matches_scalar(gen, -150.0f, -37.0f, 300, 4, 1.0f));
+            CHECK(grid3d_matches_scalar(gen, -120.0f, -2.0f, -1.0f, 250, 3, 3, 1.0f));
+        }
+    }
+
+    // Scattered batches mix runs of length one with longer ones
+    std::vector<float> xs, ys, zs;
+    for (int i = 0; i < 200; ++i) {
+        xs.push_back(i % 7 == 0 ? i * 37.0f : i * 0.5f - 50.0f);
+        ys.push_back(i % 5 == 0 ? -i * 11.0f : 3.0f);
+        zs.push_back(i * -0.25f);
+    }
+    std::vector<float> out2(xs.size()), out3(xs.size());
+    for (auto noiseType : noises) {
+        gen.SetNoiseType(noiseType);
+        gen.SetFractalType(NoiseGen::FractalType_FBm);
+        gen.GetNoiseBatch(xs.data(), ys.data(), out2.data(), xs.size());
+        gen.GetNoiseBatch(xs.data(), ys.data(), zs.data(), out3.data(), xs.size());
+
+        bool matches = true;
+        for (size_t i = 0; i < xs.size(); ++i) {
+            matches &= out2[i] == gen.GetNoise(xs[i], ys[i]);
+            matches &= out3[i] == gen.GetNoise(xs[i], ys[i], zs[i]);
+        }
+        CHECK(matches);
+    }
+}
+
+TEST_CASE("Cellular tile cache matches GetNoise") {
+    // The feature point tile is only used without a vectorized cellular kernel and with long runs per cell
+    const NoiseGen::SimdLevel detected = NoiseGen::GetSimdLevel();
+    const NoiseGen::CellularDistanceFunction distanceFunctions[] = {
+        NoiseGen::CellularDistanceFunction_Euclidean, NoiseGen::CellularDistanceFunction_EuclideanSq,
+        NoiseGen::CellularDistanceFunction_Manhattan, NoiseGen::CellularDistanceFunction_Hybrid};
+    const NoiseGen::CellularReturnType returnTypes[] = {
+        NoiseGen::CellularReturnType_CellValue,    NoiseGen::CellularReturnType_Distance,
+        NoiseGen::CellularReturnType_Distance2,    NoiseGen::CellularReturnType_Distance2Add,
+        NoiseGen::CellularReturnType_Distance2Sub, NoiseGen::CellularReturnType_Distance2Mul,
+        NoiseGen::CellularReturnType_Distance2Div};
+
+    CHECK(NoiseGen::SetSimdLevel(NoiseGen::SimdLevel_Scalar));
+
+    NoiseGen gen(77);
+    gen.SetNoiseType(NoiseGen::NoiseType_Cellular);
+    gen.SetFrequency(0.03f);
+    gen.SetCellularJitter(1.2f);
+
+    for (auto distanceFunction : distanceFunctions) {
+        for (auto returnType : returnTypes) {
+            gen.SetCellularDistanceFunction(distanceFunction);
+            gen.SetCellularReturnType(returnType);
+            CHECK(grid2d_matches_scalar(gen, -90.0f, -40.0f, 150, 4, 1.0f));
+            CHECK(grid3d_matches_scalar(gen, -70.0f, -1.5f, 20.0f, 140, 3, 2, 1.0f));
+        }
+    }
+
+    gen.SetFractalType(NoiseGen::FractalType_FBm);
+    CHECK(grid2d_matches_scalar(gen, 13.0f, -8.0f, 130, 3, 0.5f));
+    CHECK(grid3d_matches_scalar(gen, 13.0f, -8.0f, 5.0f, 130, 2, 2, 0.5f));
+
+    CHECK(NoiseGen::SetSimdLevel(detected));
+}
+
+TEST_CASE("SIMD level selection") {
+    CHECK(NoiseGen::SetSimdLevel(NoiseGen::SimdLevel_Scalar));
+    CHECK(NoiseGen::GetSimdLevel() == NoiseGen::SimdLevel_Scalar);
+
+#if defined(__x86_64__) || defined(__i386__)
+    CHECK_FALSE(NoiseGen::SetSimdLevel(NoiseGen::SimdLevel_NEON));
+    CHECK(NoiseGen::GetSimdLevel() == NoiseGen::SimdLevel_Scalar);
+#endif
+
+    CHECK(NoiseGen::SetSimdLevel(static_cast<NoiseGen::SimdLevel>(entropy::noise::simd::Detect()->level)));
+}
+
+TEST_CASE("Uniform grid edge cases") {
+    NoiseGen gen(7);
+
+    SUBCASE("Empty grid writes nothing") {
+        float sentinel = 42.0f;
+        gen.GenUniformGrid2D(&sentinel, 0.0f, 0.0f, 0, 10, 1.0f);
+        gen.GenUniformGrid3D(&sentinel, 0.0f, 0.0f, 0.0f, 4, 0, 4, 1.0f);
+        CHECK(sentinel == 42.0f);
+    }
+
+    SUBCASE("Single sample grid") {
+        float value = 0.0f;
+        gen.GenUniformGrid2D(&value, 12.0f, 34.0f, 1, 1, 1.0f);
+        CHECK(value == gen.GetNoise(12.0f, 34.0f));
+    }
+}
+
+TEST_CASE("Batch sampling matches GetNoise") {
+    // Scattered points, more than one block, with a partial last block
+    const size_t count = 150;
+    std::vector<float> xs(count), ys(count), zs(count);
+    for (size_t i = 0; i < count; ++i) {
+        xs[i] = (float)((i * 7919) % 1000) * 0.731f - 365.0f;
+        ys[i] = (float)((i * 104729) % 997) * -0.419f + 210.0f;
+        zs[i] = (float)((i * 31) % 101) * 1.37f - 70.0f;
+    }
+
+    NoiseGen gen(2468);
+    gen.SetFrequency(0.03f);
+
+    for (auto noiseType : kNoiseTypes) {
+        for (auto fractalType : kFractalTypes) {
+            gen.SetNoiseType(noiseType);
+            gen.SetFractalType(fractalType);
+
+            std::vector<float> out2(count), out3(count);
+            gen.GetNoiseBatch(xs.data(), ys.data(), out2.data(), count);
+            gen.GetNoiseBatch(xs.data(), ys.data(), zs.data(), out3.data(), count);
+
+            bool same = true;
+            for (size_t i = 0; i < count; ++i) {
+                same = same && out2[i] == gen.GetNoise(xs[i], ys[i]);
+                same = same && out3[i] == gen.GetNoise(xs[i], ys[i], zs[i]);
+            }
+            CHECK(same);
+        }
+    }
+
+    SUBCASE("Output may alias the input") {
+        gen.SetNoiseType(NoiseGen::NoiseType_Cellular);
+        std::vector<float> inPlace = xs;
+        gen.GetNoiseBatch(inPlace.data(), ys.data(), inPlace.data(), count);
+        CHECK(inPlace[count - 1] == gen.GetNoise(xs[count - 1], ys[count - 1]));
+        CHECK(inPlace[0] == gen.GetNoise(xs[0], ys[0]));
+    }
+
+    SUBCASE("Empty batch writes nothing") {
+        float sentinel = 42.0f;
+        gen.GetNoiseBatch(xs.data(), ys.data(), &sentinel, 0);
+        CHECK(sentinel == 42.0f);
+    }
+}
+
+TEST_CASE("Warped batch matches DomainWarp then GetNoise") {
+    const NoiseGen::FractalType warpFractals[] = {NoiseGen::FractalType_None,
+                                                  NoiseGen::FractalType_DomainWarpProgressive,
+                                                  NoiseGen::FractalType_DomainWarpIndependent};
+    const NoiseGen::DomainWarpType warpTypes[] = {NoiseGen::DomainWarpType_OpenSimplex2,
+                                                  NoiseGen::DomainWarpType_OpenSimplex2Reduced,
+                                                  NoiseGen::DomainWarpType_BasicGrid};
+
+    const size_t count = 150;
+    std::vector<float> xs(count), ys(count), zs(count);
+    for (size_t i = 0; i < count; ++i) {
+        xs[i] = (float)((i * 7919) % 1000) * 0.731f - 365.0f;
+        ys[i] = (float)((i * 104729) % 997) * -0.419f + 210.0f;
+        zs[i] = (float)((i * 31) % 101) * 1.37f - 70.0f;
+    }
+
+    // Separate configurations for the warp and the noise it feeds
+    NoiseGen noise(97);
+    noise.SetNoiseType(NoiseGen::NoiseType_Perlin);
+    noise.SetFractalType(NoiseGen::FractalType_FBm);
+    noise.SetFrequency(0.02f);
+
+    NoiseGen warp(-5);
+    warp.SetFrequency(0.01f);
+    warp.SetDomainWarpAmp(30.0f);
+
+    for (auto warpFractal : warpFractals) {
+        for (auto warpType : warpTypes) {
+            warp.SetFractalType(warpFractal);
+            warp.SetDomainWarpType(warpType);
+
+            std::vector<float> out2(count), out3(count);
+            noise.GetWarpedNoiseBatch(warp, xs.data(), ys.data(), out2.data(), count);
+            noise.GetWarpedNoiseBatch(warp, xs.data(), ys.data(), zs.data(), out3.data(), count);
+
+            bool same = true;
+            for (size_t i = 0; i < count; ++i) {
+                float x = xs[i], y = ys[i], z = zs[i];
+                warp.DomainWarp(x, y);
+                same = same && out2[i] == noise.GetNoise(x, y);
+
+                x = xs[i];
+                y = ys[i];
+                warp.DomainWarp(x, y, z);
+                same = same && out3[i] == noise.GetNoise(x, y, z);
+            }
+            CHECK(same);
+        }
+    }
+
+    // One generator may warp its own input, output may alias it
+    std::vector<float> inPlace = xs;
+    noise.GetWarpedNoiseBatch(noise, inPlace.data(), ys.data(), inPlace.data(), count);
+    float x = xs[count - 1], y = ys[count - 1];
+    noise.DomainWarp(x, y);
+    CHECK(inPlace[count - 1] == noise.GetNoise(x, y));
+}
@@ -0,0 +1,122 @@
+#include <doctest/doctest.h>
+#include <entropy/entropy.hpp>
+
+#include <cmath>
+#include <vector>
+
+using NoiseGen = entropy::noise::NoiseGen;
+
+namespace {
+
+    const NoiseGen::NoiseType kNoiseTypes4D[] = {NoiseGen::NoiseType_OpenSimplex2, NoiseGen::NoiseType_Perlin,
+                                                 NoiseGen::NoiseType_Value};
+
+    const NoiseGen::FractalType kFractalTypes[] = {NoiseGen::FractalType_None, NoiseGen::FractalType_FBm,
+                                                   NoiseGen::FractalType_Ridged, NoiseGen::FractalType_PingPong};
+
+} // namespace
+
+TEST_CASE("4D noise stays in range and varies") {
+    for (NoiseGen::NoiseType noise : kNoiseTypes4D) {
+        for (NoiseGen::FractalType fractal : kFractalTypes) {
+            NoiseGen gen(1337);
+            gen.SetNoiseType(noise);
+            gen.SetFractalType(fractal);
+
+            bool inRange = true;
+            double sum = 0, sumSq = 0;
+            const int n = 2000;
+            for (int i = 0; i < n; ++i) {
+                float v = gen.GetNoise(i * 3.7f, i * -2.3f, i * 1.9f, i * 0.7f);
+                // Ridged and PingPong reach the bound itself, allow its rounding
+                inRange &= std::fabs(v) <= 1.0f + 1e-5f;
+                sum += v;
+                sumSq += v * v;
+            }
+            double mean = sum / n;
+            CHECK(inRange);
+            CHECK(std::sqrt(sumSq / n - mean * mean) > 0.05);
+        }
+    }
+}
+
+TEST_CASE("4D noise is continuous") {
+    for (NoiseGen::NoiseType noise : kNoiseTypes4D) {
+        NoiseGen gen(42);
+        gen.SetNoiseType(noise);
+        gen.SetFrequency(0.05f);
+
+        bool smooth = true;
+        float prev = gen.GetNoise(0.0f, 0.0f, 0.0f, 0.0f);
+        for (int i = 1; i < 5000; ++i) {
+            float t = i * 0.02f;
+            float v = gen.GetNoise(t * 0.9f, t * -0.4f, t * 0.3f, t * 0.7f);
+            smooth &= std::fabs(v - prev) < 0.01f;
+            prev = v;
+        }
+        CHECK(smooth);
+    }
+}
+
+TEST_CASE("4D noise evolves along w") {
+    for (NoiseGen::NoiseType noise : kNoiseTypes4D) {
+        NoiseGen gen(7);
+        gen.SetNoiseType(noise);
+
+        // Same xyz slice at two times differs, a small time step changes it only slightly
+        int changed = 0;
+        bool gradual = true;
+        for (int i = 0; i < 100; ++i) {
+            float x = i * 1.3f, y = i * -0.7f, z = i * 2.1f;
+            float now = gen.GetNoise(x, y, z, 0.0f);
+            changed += now != gen.GetNoise(x, y, z, 40.0f);
+            gradual &= std::fabs(now - gen.GetNoise(x, y, z, 0.01f)) < 0.01f;
+        }
+        CHECK(changed > 95);
+        CHECK(gradual);
+    }
+}
+
+TEST_CASE("4D batch matches GetNoise") {
+    // Not a multiple of the block size
+    const size_t count = 150;
+    std::vector<float> xs(count), ys(count), zs(count), ws(count), out(count);
+    for (size_t i = 0; i < count; ++i) {
+        xs[i] = i * 0.91f - 40.0f;
+        ys[i] = i * -1.37f + 12.0f;
+        zs[i] = i * 0.23f;
+        ws[i] = i * 2.71f - 100.0f;
+    }
+
+    for (NoiseGen::NoiseType noise : kNoiseTypes4D) {
+        for (NoiseGen::FractalType fractal : kFractalTypes) {
+            NoiseGen gen(2024);
+            gen.SetNoiseType(noise);
+            gen.SetFractalType(fractal);
+            gen.GetNoiseBatch(xs.data(), ys.data(), zs.data(), ws.data(), out.data(), count);
+
+            bool matches = true;
+            for (size_t i = 0; i < count; ++i) {
+                matches &= out[i] == gen.GetNoise(xs[i], ys[i], zs[i], ws[i]);
+            }
+            CHECK(matches);
+        }
+    }
+}
+
+TEST_CASE("4D noise is zero for unsupported noise types") {
+    const NoiseGen::NoiseType noises[] = {NoiseGen::NoiseType_OpenSimplex2S, NoiseGen::NoiseType_Cellular,
+                                          NoiseGen::NoiseType_ValueCubic};
+
+    for (NoiseGen::NoiseType noise : noises) {
+        NoiseGen gen(3);
+        gen.SetNoiseType(noise);
+        gen.SetFractalType(NoiseGen::FractalType_FBm);
+
+        float x[] = {1.5f, -7.25f}, y[] = {2.0f, 3.0f}, z[] = {0.5f, 9.0f}, w[] = {4.0f, -1.0f}, out[2];
+        gen.GetNoiseBatch(x, y, z, w, out, 2);
+        CHECK(gen.GetNoise(1.5f, 2.0f, 0.5f, 4.0f) == 0.0f);
+        CHECK(out[0] == 0.0f);
+        CHECK(out[1] == 0.0f);
+    }
+}
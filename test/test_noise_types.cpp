@@ -220,3 +220,43 @@ TEST_CASE("Cellular noise configurations") {
         CHECK(std::isfinite(cell_noise));
     }
 }
+
+TEST_CASE("Pruned 3D cellular search matches the full search") {
+    using NoiseGen = entropy::noise::NoiseGen;
+    const NoiseGen::CellularDistanceFunction distanceFunctions[] = {
+        NoiseGen::CellularDistanceFunction_Euclidean, NoiseGen::CellularDistanceFunction_EuclideanSq,
+        NoiseGen::CellularDistanceFunction_Manhattan, NoiseGen::CellularDistanceFunction_Hybrid};
+    const NoiseGen::CellularReturnType returnTypes[] = {NoiseGen::CellularReturnType_CellValue,
+                                                        NoiseGen::CellularReturnType_Distance2Sub,
+                                                        NoiseGen::CellularReturnType_Distance2Div};
+    // Zero jitter puts every feature point on its cell centre, so half cell samples hit exact ties
+    const float jitters[] = {0.0f, 0.3f, 1.0f, 1.7f, -1.0f};
+
+    for (auto distanceFunction : distanceFunctions) {
+        for (auto returnType : returnTypes) {
+            for (float jitter : jitters) {
+                NoiseGen pruned(31337);
+                pruned.SetNoiseType(NoiseGen::NoiseType_Cellular);
+                pruned.SetFrequency(1.0f);
+                pruned.SetCellularDistanceFunction(distanceFunction);
+                pruned.SetCellularReturnType(returnType);
+                pruned.SetCellularJitter(jitter);
+
+                // The periodic search visits all 27 cells and wraps nothing this far inside the period
+                NoiseGen full = pruned;
+                full.SetPeriod(1000, 1000, 1000);
+
+                bool identical = true;
+                for (int i = 0; i < 400; ++i) {
+                    float x = 200.0f + i * 0.5f;
+                    float y = 300.0f + (i % 7) * 0.5f;
+                    float z = 400.0f + (i % 5) * 0.5f;
+                    identical &= pruned.GetNoise(x, y, z) == full.GetNoise(x, y, z);
+                    identical &= pruned.GetNoise(x + 0.13f, y - 0.37f, z + 0.29f) ==
+                                 full.GetNoise(x + 0.13f, y - 0.37f, z + 0.29f);
+                }
+                CHECK(identical);
+            }
+        }
+    }
+}
@@ -0,0 +1,118 @@
+#include <doctest/doctest.h>
+#include <entropy/entropy.hpp>
+
+#include <cmath>
+
+using entropy::path::OccupancyGrid;
+
+TEST_CASE("OccupancyGrid binning") {
+    OccupancyGrid grid(-10.0, 0.0, 10.0, 5.0, 4, 5);
+    CHECK(grid.width() == 4);
+    CHECK(grid.height() == 5);
+    CHECK(grid.cell_width() == 5.0);
+    CHECK(grid.cell_height() == 1.0);
+
+    grid.add(-10.0, 0.0);
+    grid.add(-5.01, 0.99);
+    grid.add(9.99, 4.5);
+    grid.add(datapod::Point{0.0, 2.0, 0.0});
+
+    CHECK(grid.at(0, 0) == 2);
+    CHECK(grid.at(3, 4) == 1);
+    CHECK(grid.at(2, 2) == 1);
+    CHECK(grid.total() == 4);
+
+    // Bounds are half-open, NaN is outside
+    grid.add(10.0, 1.0);
+    grid.add(0.0, -0.001);
+    grid.add(std::nan(""), 1.0);
+    CHECK(grid.outside() == 3);
+    CHECK(grid.total() == 4);
+
+    size_t col, row;
+    CHECK(grid.cell_of(-2.5, 3.5, col, row));
+    CHECK(col == 1);
+    CHECK(row == 3);
+    CHECK_FALSE(grid.cell_of(0.0, 5.0, col, row));
+
+    CHECK_THROWS_AS(grid.at(4, 0), std::out_of_range);
+
+    grid.clear();
+    CHECK(grid.total() == 0);
+    CHECK(grid.outside() == 0);
+    CHECK(grid.at(0, 0) == 0);
+}
+
+TEST_CASE("OccupancyGrid merge and validation") {
+    OccupancyGrid a(0.0, 0.0, 1.0, 1.0, 2, 2);
+    OccupancyGrid b(0.0, 0.0, 1.0, 1.0, 2, 2);
+    a.add(0.1, 0.1);
+    b.add(0.1, 0.1);
+    b.add(0.9, 0.9);
+    b.add(5.0, 5.0);
+
+    a.merge(b);
+    CHECK(a.at(0, 0) == 2);
+    CHECK(a.at(1, 1) == 1);
+    CHECK(a.total() == 3);
+    CHECK(a.outside() == 1);
+
+    OccupancyGrid c(0.0, 0.0, 1.0, 1.0, 3, 2);
+    CHECK_FALSE(a.same_layout(c));
+    CHECK_THROWS_AS(a.merge(c), std::invalid_argument);
+
+    CHECK_THROWS_AS(OccupancyGrid(0.0, 0.0, 1.0, 1.0, 0, 2), std::invalid_argument);
+    CHECK_THROWS_AS(OccupancyGrid(1.0, 0.0, 1.0, 1.0, 2, 2), std::invalid_argument);
+}
+
+TEST_CASE("WalkSimulation occupancy accumulation") {
+    entropy::path::WalkConfig config;
+    config.seed = 808;
+
+    // Deliberately smaller than the walks so some points fall outside
+    auto make_grid = [] { return OccupancyGrid(-40.0, -40.0, 40.0, 40.0, 64, 64); };
+
+    entropy::path::WalkSimulation reference(400, 25, config);
+    reference.generate();
+    OccupancyGrid expected = make_grid();
+    for (const auto &walker : reference.get_walkers()) {
+        for (const auto &pose : walker.get_path().waypoints) {
+            expected.add(pose.point);
+        }
+    }
+    CHECK(expected.total() + expected.outside() == 25 * 401);
+    CHECK(expected.outside() > 0);
+
+    for (size_t threads : {1, 4}) {
+        {
+            entropy::path::WalkSimulation sim(400, 25, config);
+            sim.set_num_threads(threads);
+            OccupancyGrid grid = make_grid();
+            sim.generate(grid);
+
+            CHECK(grid.counts() == expected.counts());
+            CHECK(grid.outside() == expected.outside());
+            CHECK(sim.get_walker(24).num_points() == 401);
+        }
+
+        // Streaming bins the same walks without storing them
+        {
+            entropy::path::WalkSimulation sim(400, 25, config);
+            sim.set_num_threads(threads);
+            OccupancyGrid grid = make_grid();
+            sim.stream(grid, 64);
+
+            CHECK(grid.counts() == expected.counts());
+            CHECK(grid.outside() == expected.outside());
+            CHECK(sim.get_walker(0).num_points() == 0);
+        }
+    }
+
+    SUBCASE("Counts add to the existing grid") {
+        entropy::path::WalkSimulation sim(400, 25, config);
+        OccupancyGrid grid = make_grid();
+        grid.add(0.0, 0.0);
+        sim.generate(grid);
+        CHECK(grid.total() == expected.total() + 1);
+    }
+}
@@ -0,0 +1,116 @@
+#include <doctest/doctest.h>
+#include <entropy/entropy.hpp>
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using NoiseGen = entropy::noise::NoiseGen;
+using ParallelGrid = entropy::noise::ParallelGrid;
+using WorkStealingPool = entropy::parallel::WorkStealingPool;
+
+TEST_CASE("WorkStealingPool runs every index exactly once") {
+    for (size_t threads : {1, 2, 3, 8}) {
+        WorkStealingPool pool(threads);
+        CHECK(pool.num_threads() == threads);
+
+        std::vector<std::atomic<int>> hits(1000);
+        for (int round = 0; round < 3; ++round) {
+            pool.parallel_for(hits.size(), [&](size_t i) { hits[i].fetch_add(1); });
+        }
+
+        bool all_three = true;
+        for (auto &h : hits) {
+            all_three = all_three && h.load() == 3;
+        }
+        CHECK(all_three);
+    }
+}
+
+TEST_CASE("WorkStealingPool edge cases") {
+    WorkStealingPool pool(4);
+
+    SUBCASE("Empty batch") {
+        bool called = false;
+        pool.parallel_for(0, [&](size_t) { called = true; });
+        CHECK_FALSE(called);
+    }
+
+    SUBCASE("Task exception is rethrown and pool stays usable") {
+        CHECK_THROWS_AS(pool.parallel_for(64,
+                                          [](size_t i) {
+                                              if (i == 17) {
+                                                  throw std::runtime_error("task failed");
+                                              }
+                                          }),
+                        std::runtime_error);
+
+        std::atomic<size_t> count{0};
+        pool.parallel_for(64, [&](size_t) { count.fetch_add(1); });
+        CHECK(count.load() == 64);
+    }
+
+    SUBCASE("Default thread count") {
+        WorkStealingPool default_pool;
+        CHECK(default_pool.num_threads() >= 1);
+    }
+}
+
+TEST_CASE("ParallelGrid matches single threaded grid generation") {
+    NoiseGen gen(4242);
+    gen.SetFrequency(0.03f);
+    gen.SetFractalType(NoiseGen::FractalType_FBm);
+    gen.SetFractalOctaves(3);
+
+    const NoiseGen::NoiseType noiseTypes[] = {NoiseGen::NoiseType_OpenSimplex2, NoiseGen::NoiseType_Cellular,
+                                              NoiseGen::NoiseType_Perlin};
+
+    SUBCASE("2D for any thread count and tile size") {
+        const int w = 203, h = 77;
+        std::vector<float> expected(w * h);
+
+        for (auto noiseType : noiseTypes) {
+            gen.SetNoiseType(noiseType);
+            gen.GenUniformGrid2D(expected.data(), -50.0f, 12.5f, w, h, 0.7f);
+
+            for (size_t threads : {1, 2, 5}) {
+                ParallelGrid grid(threads);
+                grid.SetTileSize(32, 8, 1);
+                std::vector<float> out(w * h, -99.0f);
+                grid.GenUniformGrid2D(gen, out.data(), -50.0f, 12.5f, w, h, 0.7f);
+                CHECK(out == expected);
+
+                grid.SetTileSize(1000, 1, 1);
+                std::fill(out.begin(), out.end(), -99.0f);
+                grid.GenUniformGrid2D(gen, out.data(), -50.0f, 12.5f, w, h, 0.7f);
+                CHECK(out == expected);
+            }
+        }
+    }
+
+    SUBCASE("3D for any thread count and tile size") {
+        const int w = 37, h = 19, d = 11;
+        std::vector<float> expected(w * h * d);
+
+        for (auto noiseType : noiseTypes) {
+            gen.SetNoiseType(noiseType);
+            gen.GenUniformGrid3D(expected.data(), 3.0f, -7.0f, 1.5f, w, h, d, 1.1f);
+
+            for (size_t threads : {1, 3, 4}) {
+                ParallelGrid grid(threads);
+                grid.SetTileSize(16, 4, 3);
+                std::vector<float> out(w * h * d, -99.0f);
+                grid.GenUniformGrid3D(gen, out.data(), 3.0f, -7.0f, 1.5f, w, h, d, 1.1f);
+                CHECK(out == expected);
+            }
+        }
+    }
+
+    SUBCASE("Empty regions write nothing") {
+        ParallelGrid grid(2);
+        float sentinel = 1.0f;
+        grid.GenUniformGrid2D(gen, &sentinel, 0.0f, 0.0f, 0, 5, 1.0f);
+        grid.GenUniformGrid3D(gen, &sentinel, 0.0f, 0.0f, 0.0f, 5, 5, 0, 1.0f);
+        CHECK(sentinel == 1.0f);
+    }
+}
@@ -0,0 +1,151 @@
+#include <doctest/doctest.h>
+#include <entropy/entropy.hpp>
+
+#include <cmath>
+#include <vector>
+
+using NoiseGen = entropy::noise::NoiseGen;
+
+namespace {
+
+    const NoiseGen::NoiseType kPeriodicTypes[] = {NoiseGen::NoiseType_OpenSimplex2, NoiseGen::NoiseType_Cellular,
+                                                  NoiseGen::NoiseType_Perlin, NoiseGen::NoiseType_ValueCubic,
+                                                  NoiseGen::NoiseType_Value};
+
+    const NoiseGen::FractalType kFractalTypes[] = {NoiseGen::FractalType_None, NoiseGen::FractalType_FBm,
+                                                   NoiseGen::FractalType_Ridged, NoiseGen::FractalType_PingPong};
+
+    // FastFloor maps negative lattice points to the cell below, which can change the last bit
+    bool same(float a, float b) { return std::fabs(a - b) <= 1e-5f; }
+
+    // Power of two frequency and dyadic coordinates keep every scaled coordinate exact
+    NoiseGen make_gen(NoiseGen::NoiseType noise, NoiseGen::FractalType fractal) {
+        NoiseGen gen(2718);
+        gen.SetNoiseType(noise);
+        gen.SetFractalType(fractal);
+        gen.SetFrequency(0.125f);
+        gen.SetPeriod(4, 6, 5);
+        return gen;
+    }
+
+} // namespace
+
+TEST_CASE("Periodic noise tiles") {
+    // Periods of 4, 6 and 5 cells at frequency 1/8
+    const float px = 32.0f, py = 48.0f, pz = 40.0f;
+
+    for (NoiseGen::NoiseType noise : kPeriodicTypes) {
+        for (NoiseGen::FractalType fractal : kFractalTypes) {
+            NoiseGen gen = make_gen(noise, fractal);
+
+            bool tiles = true;
+            // Dyadic offsets stay exact and keep samples off half cells, where the unrotated simplex lattice
+            // has ties
+            for (int i = 0; i < 300; ++i) {
+                float x = i * 0.25f - 20.0f + 3 / 128.0f;
+                float y = i * -0.5f + 30.0f + 5 / 128.0f;
+                float z = i * 0.75f - 50.0f + 7 / 128.0f;
+
+                float v2 = gen.GetNoise(x, y);
+                tiles &= same(gen.GetNoise(x + px, y), v2);
+                tiles &= same(gen.GetNoise(x, y - py), v2);
+                tiles &= same(gen.GetNoise(x - 3 * px, y + 2 * py), v2);
+
+                float v3 = gen.GetNoise(x, y, z);
+                tiles &= same(gen.GetNoise(x + px, y, z), v3);
+                tiles &= same(gen.GetNoise(x, y + py, z), v3);
+                tiles &= same(gen.GetNoise(x, y, z + pz), v3);
+                tiles &= same(gen.GetNoiseDouble(x - px, y, z - pz), v3);
+            }
+            CHECK(tiles);
+        }
+    }
+}
+
+TEST_CASE("Periodic noise matches plain noise inside one period") {
+    const NoiseGen::NoiseType noises[] = {NoiseGen::NoiseType_Cellular, NoiseGen::NoiseType_Perlin,
+                                          NoiseGen::NoiseType_ValueCubic, NoiseGen::NoiseType_Value};
+
+    for (NoiseGen::NoiseType noise : noises) {
+        for (NoiseGen::FractalType fractal : kFractalTypes) {
+            NoiseGen plain(2718);
+            plain.SetNoiseType(noise);
+            plain.SetFractalType(fractal);
+            plain.SetFrequency(0.05f);
+
+            // Square lattices without skew, so wrapping only changes cells past the period
+            NoiseGen periodic = plain;
+            periodic.SetPeriod(1000, 1000, 1000);
+
+            bool identical = true;
+            for (int i = 0; i < 200; ++i) {
+                float x = 100.0f + i * 0.37f;
+                float y = 200.0f + i * 0.61f;
+                float z = 300.0f + i * 0.13f;
+                identical &= periodic.GetNoise(x, y) == plain.GetNoise(x, y);
+                identical &= periodic.GetNoise(x, y, z) == plain.GetNoise(x, y, z);
+            }
+            CHECK(identical);
+        }
+    }
+}
+
+TEST_CASE("Periodic grids and batches") {
+    NoiseGen gen = make_gen(NoiseGen::NoiseType_Perlin, NoiseGen::FractalType_FBm);
+
+    // One period plus one column and row, the extra ones repeat the first
+    const int w = 33, h = 49;
+    std::vector<float> grid(w * h);
+    gen.GenUniformGrid2D(grid.data(), 0.0f, 0.0f, w, h, 1.0f);
+
+    bool matches = true, tiles = true;
+    for (int iy = 0; iy < h; ++iy) {
+        for (int ix = 0; ix < w; ++ix) {
+            matches &= grid[iy * w + ix] == gen.GetNoise((float)ix, (float)iy);
+        }
+        tiles &= grid[iy * w] == grid[iy * w + 32];
+    }
+    for (int ix = 0; ix < w; ++ix) {
+        tiles &= grid[ix] == grid[48 * w + ix];
+    }
+    CHECK(matches);
+    CHECK(tiles);
+
+    std::vector<float> volume(8 * 8 * 8);
+    gen.GenUniformGrid3D(volume.data(), -3.0f, 5.0f, 7.0f, 8, 8, 8, 0.5f);
+    CHECK(volume[7 * 64 + 6 * 8 + 5] == gen.GetNoise(-3.0f + 2.5f, 5.0f + 3.0f, 7.0f + 3.5f));
+
+    std::vector<float> xs = {1.0f, 33.0f, -31.0f}, ys = {2.0f, 2.0f, 50.0f}, out(3);
+    gen.GetNoiseBatch(xs.data(), ys.data(), out.data(), out.size());
+    CHECK(out[0] == gen.GetNoise(1.0f, 2.0f));
+    CHECK(out[1] == out[0]);
+    CHECK(out[2] == out[0]);
+}
+
+TEST_CASE("Periodic mode configuration") {
+    NoiseGen gen(5);
+    gen.SetNoiseType(NoiseGen::NoiseType_Perlin);
+    float before = gen.GetNoise(123.4f, -56.7f);
+    size_t hash = gen.GetConfigHash();
+
+    gen.SetPeriod(3, 3, 3);
+    CHECK(gen.GetConfigHash() != hash);
+
+    // Zero or negative periods turn wrapping off
+    gen.SetPeriod(0, -2, 0);
+    CHECK(gen.GetNoise(123.4f, -56.7f) == before);
+    CHECK(gen.GetConfigHash() == hash);
+
+    // Only the x axis wraps
+    gen.SetFrequency(0.125f);
+    gen.SetPeriod(2, 0, 0);
+    CHECK(gen.GetNoise(1.5f, 7.25f) == gen.GetNoise(17.5f, 7.25f));
+    CHECK(gen.GetNoise(1.5f, 7.25f) != gen.GetNoise(1.5f, 23.25f));
+
+    // OpenSimplex2S has no periodic kernel
+    NoiseGen plain(5);
+    plain.SetNoiseType(NoiseGen::NoiseType_OpenSimplex2S);
+    NoiseGen periodic = plain;
+    periodic.SetPeriod(4, 4, 4);
+    CHECK(periodic.GetNoise(12.5f, 3.5f) == plain.GetNoise(12.5f, 3.5f));
+}
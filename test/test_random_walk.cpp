@@ -1,6 +1,9 @@
+#include <algorithm>
 #include <cmath>
 #include <doctest/doctest.h>
 #include <entropy/entropy.hpp>
+#include <thread>
+#include <vector>
 
 TEST_CASE("RandomWalk basic construction") {
     SUBCASE("Default config constructor") {
@@ -69,6 +72,300 @@ TEST_CASE("RandomWalk path generation") {
     }
 }
 
+TEST_CASE("RandomWalk compact lattice storage") {
+    entropy::path::WalkConfig config;
+    config.seed = 9;
+    entropy::path::RandomWalk walker(500, config);
+    CHECK(walker.num_points() == 0);
+    walker.generate();
+
+    const auto &lx = walker.get_lattice_x();
+    const auto &ly = walker.get_lattice_y();
+    REQUIRE(walker.num_points() == 501);
+    REQUIRE(lx.size() == 501);
+    REQUIRE(ly.size() == 501);
+    CHECK(lx[0] == 0);
+    CHECK(ly[0] == 0);
+
+    bool unit_steps = true;
+    for (size_t i = 1; i < lx.size(); ++i) {
+        int dx = lx[i] - lx[i - 1];
+        int dy = ly[i] - ly[i - 1];
+        unit_steps = unit_steps && dx >= -1 && dx <= 1 && dy >= -1 && dy <= 1 && (dx != 0 || dy != 0);
+    }
+    CHECK(unit_steps);
+
+    SUBCASE("Materialized path matches the lattice") {
+        const auto &path = walker.get_path();
+        REQUIRE(path.size() == walker.num_points());
+
+        bool same = true;
+        for (size_t i = 0; i < path.size(); ++i) {
+            auto p = walker.get_point(i);
+            same = same && path.waypoints[i].point.x == p.x && path.waypoints[i].point.y == p.y;
+            same = same && p.x == walker.get_start_point().x + walker.get_speed() * lx[i];
+        }
+        CHECK(same);
+        CHECK(path.waypoints[500].point.x == walker.get_end_point().x);
+        CHECK(path.waypoints[500].point.y == walker.get_end_point().y);
+    }
+
+    SUBCASE("Regenerating refreshes the materialized path") {
+        auto before = walker.get_path().waypoints[1].point;
+        walker.set_seed(10);
+        walker.generate();
+        auto after = walker.get_path().waypoints[1].point;
+        CHECK(after.x == walker.get_point(1).x);
+        CHECK(after.y == walker.get_point(1).y);
+        CHECK((before.x != after.x || before.y != after.y));
+    }
+
+    SUBCASE("Concurrent first calls build the path once") {
+        std::vector<const datapod::Path *> seen(8, nullptr);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < seen.size(); ++t) {
+            threads.emplace_back([&, t]() { seen[t] = &walker.get_path(); });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        bool same = true;
+        for (auto *path : seen) {
+            same = same && path == seen[0];
+        }
+        CHECK(same);
+        CHECK(seen[0]->size() == walker.num_points());
+        CHECK(seen[0]->waypoints[500].point.x == walker.get_end_point().x);
+    }
+
+    SUBCASE("Copies rebuild their own path") {
+        walker.get_path();
+        entropy::path::RandomWalk copy = walker;
+        CHECK(&copy.get_path() != &walker.get_path());
+        CHECK(copy.get_path().size() == walker.get_path().size());
+        CHECK(copy.get_path().waypoints[250].point.x == walker.get_path().waypoints[250].point.x);
+    }
+}
+
+TEST_CASE("RandomWalk bulk directions") {
+    for (auto pattern : {entropy::path::MovePattern::Moore, entropy::path::MovePattern::Neumann}) {
+        entropy::path::WalkConfig config;
+        config.seed = 31;
+        config.move_pattern = pattern;
+        config.bulk_directions = true;
+
+        // Not a multiple of the directions per RNG word, so the last word is partial
+        entropy::path::RandomWalk walker(10007, config);
+        walker.generate();
+        REQUIRE(walker.num_points() == 10008);
+
+        const auto &lx = walker.get_lattice_x();
+        const auto &ly = walker.get_lattice_y();
+        int counts[3][3] = {};
+        bool unit_steps = true;
+        for (size_t i = 1; i < lx.size() && unit_steps; ++i) {
+            int dx = lx[i] - lx[i - 1];
+            int dy = ly[i] - ly[i - 1];
+            unit_steps = dx >= -1 && dx <= 1 && dy >= -1 && dy <= 1;
+            if (unit_steps) {
+                ++counts[dx + 1][dy + 1];
+            }
+        }
+        REQUIRE(unit_steps);
+
+        // Every allowed direction is drawn about equally often
+        CHECK(counts[1][1] == 0);
+        bool moore = pattern == entropy::path::MovePattern::Moore;
+        int expected = moore ? 10007 / 8 : 10007 / 4;
+        for (int dx = 0; dx < 3; ++dx) {
+            for (int dy = 0; dy < 3; ++dy) {
+                bool diagonal = dx != 1 && dy != 1;
+                if ((dx == 1 && dy == 1) || (diagonal && !moore)) {
+                    CHECK(counts[dx][dy] == 0);
+                } else {
+                    CHECK(std::abs(counts[dx][dy] - expected) < expected / 5);
+                }
+            }
+        }
+
+        entropy::path::RandomWalk again(10007, config);
+        again.generate();
+        CHECK(again.get_lattice_x() == lx);
+        CHECK(again.get_lattice_y() == ly);
+        CHECK(again.get_end_point().x == walker.get_path().waypoints[10007].point.x);
+    }
+}
+
+TEST_CASE("RandomWalk counter-based RNG") {
+    entropy::path::WalkConfig config;
+    config.seed = 4242;
+    config.rng = entropy::path::WalkRng::SplitMix64;
+
+    SUBCASE("Random access matches the generated walk") {
+        entropy::path::RandomWalk fresh(1000, config);
+        auto end = fresh.get_end_point();
+        auto start = fresh.get_start_point();
+        auto middle = fresh.position_at(357);
+
+        entropy::path::RandomWalk walker(1000, config);
+        walker.generate();
+        CHECK(walker.get_start_point().x == start.x);
+        CHECK(walker.get_start_point().y == start.y);
+        CHECK(walker.get_end_point().x == end.x);
+        CHECK(walker.get_end_point().y == end.y);
+        CHECK(walker.get_point(357).x == middle.x);
+        CHECK(walker.get_point(357).y == middle.y);
+        CHECK(walker.position_at(357).x == middle.x);
+
+        CHECK_THROWS_AS(walker.position_at(1001), std::out_of_range);
+    }
+
+    SUBCASE("Parallel generation is identical to serial") {
+        for (auto pattern : {entropy::path::MovePattern::Moore, entropy::path::MovePattern::Neumann}) {
+            config.move_pattern = pattern;
+            entropy::path::RandomWalk serial(300007, config);
+            serial.generate();
+
+            entropy::path::RandomWalk parallel(300007, config);
+            parallel.set_num_threads(4);
+            CHECK(parallel.get_num_threads() == 4);
+            parallel.generate();
+
+            CHECK(parallel.get_lattice_x() == serial.get_lattice_x());
+            CHECK(parallel.get_lattice_y() == serial.get_lattice_y());
+
+            entropy::path::RandomWalk fresh(300007, config);
+            CHECK(fresh.get_end_point().x == serial.get_end_point().x);
+            CHECK(fresh.get_end_point().y == serial.get_end_point().y);
+        }
+    }
+
+    SUBCASE("Steps follow the move pattern") {
+        config.move_pattern = entropy::path::MovePattern::Neumann;
+        entropy::path::RandomWalk walker(2000, config);
+        walker.generate();
+
+        const auto &lx = walker.get_lattice_x();
+        const auto &ly = walker.get_lattice_y();
+        bool cardinal = true;
+        for (size_t i = 1; i < lx.size(); ++i) {
+            cardinal = cardinal && std::abs(lx[i] - lx[i - 1]) + std::abs(ly[i] - ly[i - 1]) == 1;
+        }
+        CHECK(cardinal);
+    }
+
+    SUBCASE("Seeds give different walks") {
+        entropy::path::RandomWalk a(500, config);
+        config.seed = 4243;
+        entropy::path::RandomWalk b(500, config);
+        a.generate();
+        b.generate();
+        CHECK(a.get_lattice_x() != b.get_lattice_x());
+    }
+
+    SUBCASE("MT19937 walks need generate() for random access") {
+        entropy::path::RandomWalk walker(100, 7);
+        CHECK_THROWS_AS(walker.position_at(10), std::logic_error);
+        walker.generate();
+        CHECK(walker.position_at(10).x == walker.get_path().waypoints[10].point.x);
+    }
+}
+
+TEST_CASE("RandomWalk streaming") {
+    for (auto rng : {entropy::path::WalkRng::MT19937, entropy::path::WalkRng::SplitMix64}) {
+        entropy::path::WalkConfig config;
+        config.seed = 515;
+        config.rng = rng;
+
+        entropy::path::RandomWalk stored(10000, config);
+        stored.generate();
+        const auto &path = stored.get_path();
+
+        entropy::path::RandomWalk streamed(10000, config);
+        size_t next = 0;
+        size_t largest = 0;
+        bool same = true;
+        auto stats = streamed.stream(
+            [&](const entropy::path::WalkBlock &block) {
+                same = same && block.first == next;
+                for (size_t i = 0; i < block.count; ++i) {
+                    auto p = block.point(i);
+                    same = same && p.x == path.waypoints[next + i].point.x && p.y == path.waypoints[next + i].point.y;
+                }
+                next += block.count;
+                largest = std::max(largest, block.count);
+            },
+            1000);
+
+        CHECK(same);
+        CHECK(next == 10001);
+        CHECK(largest == 1000);
+        CHECK(streamed.num_points() == 0);
+
+        // Statistics agree with the stored walk
+        double min_x = 1e300, max_x = -1e300, min_y = 1e300, max_y = -1e300, sum = 0.0;
+        auto start = path.waypoints[0].point;
+        for (size_t i = 0; i < path.size(); ++i) {
+            auto p = path.waypoints[i].point;
+            min_x = std::min(min_x, p.x);
+            max_x = std::max(max_x, p.x);
+            min_y = std::min(min_y, p.y);
+            max_y = std::max(max_y, p.y);
+            if (i > 0) {
+                sum += (p.x - start.x) * (p.x - start.x) + (p.y - start.y) * (p.y - start.y);
+            }
+        }
+
+        CHECK(stats.num_points == 10001);
+        CHECK(stats.start.x == stored.get_start_point().x);
+        CHECK(stats.end.x == stored.get_end_point().x);
+        CHECK(stats.end.y == stored.get_end_point().y);
+        CHECK(stats.min_x == min_x);
+        CHECK(stats.max_x == max_x);
+        CHECK(stats.min_y == min_y);
+        CHECK(stats.max_y == max_y);
+        CHECK(std::abs(stats.mean_squared_displacement - sum / 10000) <= 1e-9 * stats.mean_squared_displacement);
+
+        auto end = stored.get_end_point();
+        double dx = end.x - start.x, dy = end.y - start.y;
+        CHECK(std::abs(stats.squared_displacement() - (dx * dx + dy * dy)) <= 1e-9 * (dx * dx + dy * dy) + 1e-9);
+        CHECK(stats.bounds().size.x == max_x - min_x);
+    }
+
+    SUBCASE("Statistics only") {
+        entropy::path::RandomWalk walker(5000, 3);
+        auto stats = walker.stream();
+        CHECK(stats.num_points == 5001);
+        CHECK(stats.min_x <= stats.end.x);
+        CHECK(stats.max_x >= stats.end.x);
+        CHECK(stats.mean_squared_displacement > 0.0);
+    }
+}
+
+TEST_CASE("RandomWalk stream leaves generate unchanged") {
+    for (bool bulk : {false, true}) {
+        entropy::path::WalkConfig config;
+        config.seed = 77;
+        config.bulk_directions = bulk;
+
+        entropy::path::RandomWalk fresh(2000, config);
+        fresh.generate();
+
+        entropy::path::RandomWalk walker(2000, config);
+        auto first = walker.stream();
+        auto second = walker.stream();
+        walker.generate();
+
+        CHECK(first.end.x == second.end.x);
+        CHECK(first.end.y == second.end.y);
+        CHECK(walker.get_lattice_x() == fresh.get_lattice_x());
+        CHECK(walker.get_lattice_y() == fresh.get_lattice_y());
+        CHECK(walker.get_start_point().x == fresh.get_start_point().x);
+        CHECK(walker.get_end_point().y == first.end.y);
+    }
+}
+
 TEST_CASE("RandomWalk deterministic behavior") {
     SUBCASE("Same seed produces same path") {
         entropy::path::WalkConfig config;
@@ -305,6 +602,66 @@ TEST_CASE("WalkSimulation bounds") {
         CHECK(bounds.size.x > 0);
         CHECK(bounds.size.y > 0);
     }
+
+    SUBCASE("Bounds cover every point exactly") {
+        double min_x = 1e300, max_x = -1e300, min_y = 1e300, max_y = -1e300;
+        for (const auto &walker : sim.get_walkers()) {
+            for (const auto &pose : walker.get_path().waypoints) {
+                min_x = std::min(min_x, pose.point.x);
+                max_x = std::max(max_x, pose.point.x);
+                min_y = std::min(min_y, pose.point.y);
+                max_y = std::max(max_y, pose.point.y);
+            }
+        }
+
+        auto bounds = sim.get_bounds();
+        CHECK(bounds.size.x == max_x - min_x);
+        CHECK(bounds.size.y == max_y - min_y);
+        CHECK(bounds.pose.point.x == (min_x + max_x) / 2.0);
+        CHECK(bounds.pose.point.y == (min_y + max_y) / 2.0);
+    }
+}
+
+TEST_CASE("WalkSimulation parallel generation") {
+    entropy::path::WalkConfig config;
+    config.seed = 77;
+
+    entropy::path::WalkSimulation serial(200, 37, config);
+    serial.generate();
+    CHECK(serial.get_num_threads() == 1);
+
+    for (size_t threads : {2, 4, 0}) {
+        entropy::path::WalkSimulation sim(200, 37, config);
+        sim.set_num_threads(threads);
+        CHECK(sim.get_num_threads() >= 1);
+        sim.generate();
+
+        bool identical = true;
+        for (size_t i = 0; i < sim.num_walkers(); ++i) {
+            const auto &a = serial.get_walker(i).get_path().waypoints;
+            const auto &b = sim.get_walker(i).get_path().waypoints;
+            identical = identical && a.size() == b.size();
+            for (size_t j = 0; identical && j < a.size(); ++j) {
+                identical = a[j].point.x == b[j].point.x && a[j].point.y == b[j].point.y;
+            }
+        }
+        CHECK(identical);
+
+        auto expected = serial.get_bounds();
+        auto bounds = sim.get_bounds();
+        CHECK(bounds.pose.point.x == expected.pose.point.x);
+        CHECK(bounds.pose.point.y == expected.pose.point.y);
+        CHECK(bounds.size.x == expected.size.x);
+        CHECK(bounds.size.y == expected.size.y);
+    }
+
+    SUBCASE("Back to serial") {
+        entropy::path::WalkSimulation sim(10, 2, config);
+        sim.set_num_threads(4);
+        sim.set_num_threads(1);
+        CHECK(sim.get_num_threads() == 1);
+        CHECK_NOTHROW(sim.generate());
+    }
 }
 
 TEST_CASE("WalkSimulation walker access") {
@@ -0,0 +1,95 @@
+#include <doctest/doctest.h>
+#include <entropy/entropy.hpp>
+
+using NoiseGen = entropy::noise::NoiseGen;
+template <NoiseGen::NoiseType N, NoiseGen::FractalType F = NoiseGen::FractalType_None,
+          NoiseGen::CellularDistanceFunction D = NoiseGen::CellularDistanceFunction_EuclideanSq,
+          NoiseGen::CellularReturnType R = NoiseGen::CellularReturnType_Distance, int O = 3>
+using StaticNoise = entropy::noise::StaticNoise<N, F, D, R, O>;
+
+namespace {
+
+    // Compares a StaticNoise against a NoiseGen configured the same way at runtime
+    template <NoiseGen::NoiseType N, NoiseGen::FractalType F, NoiseGen::CellularDistanceFunction D,
+              NoiseGen::CellularReturnType R, int O>
+    bool matches_runtime(StaticNoise<N, F, D, R, O> &fixed) {
+        fixed.SetSeed(911);
+        fixed.SetFrequency(0.07f);
+        fixed.SetFractalGain(0.45f);
+        fixed.SetFractalLacunarity(2.2f);
+        fixed.SetFractalWeightedStrength(0.3f);
+        fixed.SetCellularJitter(0.9f);
+
+        NoiseGen gen(911);
+        gen.SetNoiseType(N);
+        gen.SetFractalType(F);
+        gen.SetFractalOctaves(O);
+        gen.SetCellularDistanceFunction(D);
+        gen.SetCellularReturnType(R);
+        gen.SetFrequency(0.07f);
+        gen.SetFractalGain(0.45f);
+        gen.SetFractalLacunarity(2.2f);
+        gen.SetFractalWeightedStrength(0.3f);
+        gen.SetCellularJitter(0.9f);
+
+        for (int i = 0; i < 200; ++i) {
+            float x = i * 3.7f - 300.0f;
+            float y = i * -1.3f + 50.0f;
+            float z = i * 0.9f;
+            if (fixed.GetNoise(x, y) != gen.GetNoise(x, y) || fixed.GetNoise(x, y, z) != gen.GetNoise(x, y, z)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace
+
+TEST_CASE("StaticNoise matches runtime NoiseGen") {
+    SUBCASE("Plain noise types") {
+        StaticNoise<NoiseGen::NoiseType_OpenSimplex2> a;
+        StaticNoise<NoiseGen::NoiseType_OpenSimplex2S> b;
+        StaticNoise<NoiseGen::NoiseType_Perlin> c;
+        StaticNoise<NoiseGen::NoiseType_Value> d;
+        StaticNoise<NoiseGen::NoiseType_ValueCubic> e;
+        CHECK(matches_runtime(a));
+        CHECK(matches_runtime(b));
+        CHECK(matches_runtime(c));
+        CHECK(matches_runtime(d));
+        CHECK(matches_runtime(e));
+    }
+
+    SUBCASE("Fractal types and octave counts") {
+        StaticNoise<NoiseGen::NoiseType_OpenSimplex2, NoiseGen::FractalType_FBm,
+                    NoiseGen::CellularDistanceFunction_EuclideanSq, NoiseGen::CellularReturnType_Distance, 6>
+            fbm;
+        StaticNoise<NoiseGen::NoiseType_Perlin, NoiseGen::FractalType_Ridged,
+                    NoiseGen::CellularDistanceFunction_EuclideanSq, NoiseGen::CellularReturnType_Distance, 1>
+            ridged;
+        StaticNoise<NoiseGen::NoiseType_ValueCubic, NoiseGen::FractalType_PingPong> pingPong;
+        CHECK(matches_runtime(fbm));
+        CHECK(matches_runtime(ridged));
+        CHECK(matches_runtime(pingPong));
+    }
+
+    SUBCASE("Cellular distance functions and return types") {
+        StaticNoise<NoiseGen::NoiseType_Cellular, NoiseGen::FractalType_None,
+                    NoiseGen::CellularDistanceFunction_Euclidean, NoiseGen::CellularReturnType_Distance2Div>
+            euclidean;
+        StaticNoise<NoiseGen::NoiseType_Cellular, NoiseGen::FractalType_FBm,
+                    NoiseGen::CellularDistanceFunction_Manhattan, NoiseGen::CellularReturnType_CellValue, 2>
+            manhattan;
+        StaticNoise<NoiseGen::NoiseType_Cellular, NoiseGen::FractalType_None, NoiseGen::CellularDistanceFunction_Hybrid,
+                    NoiseGen::CellularReturnType_Distance2Sub>
+            hybrid;
+        CHECK(matches_runtime(euclidean));
+        CHECK(matches_runtime(manhattan));
+        CHECK(matches_runtime(hybrid));
+    }
+
+    SUBCASE("Rotation and exposed runtime generator") {
+        StaticNoise<NoiseGen::NoiseType_Perlin, NoiseGen::FractalType_FBm> fixed(5);
+        fixed.SetRotationType3D(NoiseGen::RotationType3D_ImproveXZPlanes);
+        CHECK(fixed.GetNoise(1.5f, 2.5f, 3.5f) == fixed.GetNoiseGen().GetNoise(1.5f, 2.5f, 3.5f));
+    }
+}
@@ -0,0 +1,162 @@
+#include <doctest/doctest.h>
+#include <entropy/entropy.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using entropy::path::WalkIndex;
+using entropy::path::WalkSegment;
+
+namespace {
+
+    double distance_squared(const datapod::Point &p, const datapod::Point &a, const datapod::Point &b) {
+        double dx = b.x - a.x, dy = b.y - a.y;
+        double t = std::clamp(((p.x - a.x) * dx + (p.y - a.y) * dy) / (dx * dx + dy * dy), 0.0, 1.0);
+        double ex = a.x + t * dx - p.x, ey = a.y + t * dy - p.y;
+        return ex * ex + ey * ey;
+    }
+
+    // Brute force over every segment of every walker
+    template <typename Pred> std::vector<WalkSegment> scan(const entropy::path::WalkSimulation &sim, Pred pred) {
+        std::vector<WalkSegment> hits;
+        for (size_t w = 0; w < sim.num_walkers(); ++w) {
+            const auto &walker = sim.get_walker(w);
+            for (size_t s = 1; s < walker.num_points(); ++s) {
+                if (pred(walker.get_point(s - 1), walker.get_point(s))) {
+                    hits.push_back({w, s});
+                }
+            }
+        }
+        return hits;
+    }
+
+    double cross(const datapod::Point &o, const datapod::Point &a, const datapod::Point &b) {
+        return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+    }
+
+    // Proper crossings only; touching cases are measure-zero for random walks with random speeds
+    bool crosses(const datapod::Point &a, const datapod::Point &b, const datapod::Point &c, const datapod::Point &d) {
+        return (cross(a, b, c) > 0) != (cross(a, b, d) > 0) && (cross(c, d, a) > 0) != (cross(c, d, b) > 0);
+    }
+
+} // namespace
+
+TEST_CASE("WalkIndex queries match brute force") {
+    entropy::path::WalkConfig config;
+    config.seed = 2024;
+    entropy::path::WalkSimulation sim(300, 40, config);
+    sim.generate();
+
+    for (double cell_size : {0.0, 0.7, 25.0}) {
+        WalkIndex index(sim, cell_size);
+        CHECK(index.num_segments() == 40 * 300);
+        CHECK(index.cell_size() > 0.0);
+
+        bool radius_ok = true, box_ok = true, segment_ok = true;
+        for (int i = 0; i < 20; ++i) {
+            datapod::Point center{i * 3.1 - 30.0, i * -2.3 + 20.0, 0.0};
+            double radius = 1.0 + i * 0.5;
+
+            auto expected = scan(sim, [&](const datapod::Point &a, const datapod::Point &b) {
+                return distance_squared(center, a, b) <= radius * radius;
+            });
+            radius_ok = radius_ok && index.query_radius(center, radius) == expected;
+
+            double min_x = center.x - radius, max_x = center.x + radius * 0.5;
+            double min_y = center.y - radius * 0.5, max_y = center.y + radius;
+            auto in_box = scan(sim, [&](const datapod::Point &a, const datapod::Point &b) {
+                // Dense sampling is exact enough for a brute-force reference
+                for (int k = 0; k <= 64; ++k) {
+                    double t = k / 64.0;
+                    double x = a.x + t * (b.x - a.x), y = a.y + t * (b.y - a.y);
+                    if (x >= min_x && x <= max_x && y >= min_y && y <= max_y) {
+                        return true;
+                    }
+                }
+                return false;
+            });
+            auto boxed = index.query_box(min_x, min_y, max_x, max_y);
+            box_ok = box_ok && std::includes(boxed.begin(), boxed.end(), in_box.begin(), in_box.end());
+            for (const auto &hit : boxed) {
+                auto a = sim.get_walker(hit.walker).get_point(hit.step - 1);
+                auto b = sim.get_walker(hit.walker).get_point(hit.step);
+                box_ok = box_ok && std::max(a.x, b.x) >= min_x && std::min(a.x, b.x) <= max_x &&
+                         std::max(a.y, b.y) >= min_y && std::min(a.y, b.y) <= max_y;
+            }
+
+            datapod::Point p{center.x - 5.0, center.y - 3.0, 0.0}, q{center.x + 4.0, center.y + 6.0, 0.0};
+            auto crossing = scan(sim, [&](const datapod::Point &a, const datapod::Point &b) {
+                return crosses(p, q, a, b);
+            });
+            segment_ok = segment_ok && index.query_segment(p, q) == crossing;
+        }
+        CHECK(radius_ok);
+        CHECK(box_ok);
+        CHECK(segment_ok);
+    }
+}
+
+TEST_CASE("WalkIndex walkers_within") {
+    entropy::path::WalkConfig config;
+    config.seed = 7;
+    config.random_start = false;
+    entropy::path::WalkSimulation sim(50, 12, config);
+    sim.generate();
+    WalkIndex index(sim);
+
+    // Every walker starts at the origin
+    auto all = index.walkers_within(datapod::Point{0.0, 0.0, 0.0}, 0.0);
+    CHECK(all.size() == 12);
+    CHECK(std::is_sorted(all.begin(), all.end()));
+
+    CHECK(index.walkers_within(datapod::Point{1e6, 1e6, 0.0}, 10.0).empty());
+    CHECK(index.query_radius(datapod::Point{0.0, 0.0, 0.0}, -1.0).empty());
+}
+
+TEST_CASE("WalkIndex first_crossing") {
+    entropy::path::WalkConfig config;
+    config.seed = 99;
+    entropy::path::WalkSimulation sim(400, 6, config);
+    sim.generate();
+    WalkIndex index(sim);
+
+    int found = 0;
+    for (size_t a = 0; a < sim.num_walkers(); ++a) {
+        for (size_t b = 0; b < sim.num_walkers(); ++b) {
+            if (a == b) {
+                continue;
+            }
+
+            // Brute force: earliest step of a crossing any step of b
+            const auto &wa = sim.get_walker(a);
+            const auto &wb = sim.get_walker(b);
+            size_t step_a = 0, step_b = 0;
+            for (size_t s = 1; s < wa.num_points() && step_a == 0; ++s) {
+                for (size_t t = 1; t < wb.num_points(); ++t) {
+                    if (crosses(wa.get_point(s - 1), wa.get_point(s), wb.get_point(t - 1), wb.get_point(t))) {
+                        step_a = s;
+                        step_b = t;
+                        break;
+                    }
+                }
+            }
+
+            WalkSegment hit_a, hit_b;
+            bool met = index.first_crossing(a, b, hit_a, hit_b);
+            CHECK(met == (step_a != 0));
+            if (met) {
+                ++found;
+                CHECK(hit_a.walker == a);
+                CHECK(hit_b.walker == b);
+                CHECK(hit_a.step == step_a);
+                CHECK(hit_b.step == step_b);
+            }
+        }
+    }
+    CHECK(found > 0);
+
+    WalkSegment hit_a, hit_b;
+    CHECK_THROWS_AS(index.first_crossing(0, 0, hit_a, hit_b), std::invalid_argument);
+    CHECK_THROWS_AS(index.first_crossing(0, 6, hit_a, hit_b), std::out_of_range);
+}
@@ -17,6 +17,9 @@ local EXAMPLE_DEPS = {
 local TEST_DEPS = {
     {"doctest", "https://github.com/doctest/doctest.git", "v2.4.11"},
 }
+local BENCH_DEPS = {
+    "benchmark",
+}
 
 set_project(PROJECT_NAME)
 set_version(PROJECT_VERSION)
@@ -43,7 +46,9 @@ local COMMON_FLAGS = {
     "-Wall", "-Wextra", "-Wpedantic",
     "-Wno-reorder", "-Wno-narrowing", "-Wno-array-bounds",
     "-Wno-unused-variable", "-Wno-unused-parameter",
-    "-Wno-unused-but-set-variable", "-Wno-gnu-line-marker", "-Wno-comment"
+    "-Wno-unused-but-set-variable", "-Wno-gnu-line-marker", "-Wno-comment",
+    -- Keep float results independent of call site (no FMA contraction)
+    "-ffp-contract=off"
 }
 
 -- Add common flags
@@ -68,7 +73,8 @@ option("simd", {default = true, showmenu = true, description = "Enable SIMD opti
 -- Architecture-specific SIMD flags
 if get_config("simd") ~= false then
     if is_arch("x86_64", "x64", "i386", "x86") then
-        add_cxxflags("-mavx", "-mavx2", "-mfma")
+        -- No global -m flags: SSE4.1/AVX2/AVX-512 kernels are compiled per ISA and picked at runtime
+        -- (see include/entropy/simd.hpp), so binaries stay portable to older CPUs
     elseif is_arch("arm64", "arm64-v8a", "aarch64") then
         -- ARM64: NEON is enabled by default
     elseif is_arch("arm", "armv7", "armv7-a") then
@@ -76,7 +82,7 @@ if get_config("simd") ~= false then
     end
 else
     -- Define macro to disable SIMD in the code
-    add_defines("OPTINUM_SIMD_DISABLED")
+    add_defines("ENTROPY_SIMD_DISABLED")
     print("SIMD optimizations disabled")
 end
 
@@ -84,6 +90,7 @@ end
 -- Options
 option("examples", {default = false, showmenu = true, description = "Build examples"})
 option("tests",    {default = false, showmenu = true, description = "Enable tests"})
+option("benchmarks", {default = false, showmenu = true, description = "Build benchmarks"})
 option("short_namespace", {default = false, showmenu = true, description = "Enable short namespace alias"})
 option("expose_all", {default = false, showmenu = true, description = "Expose all submodule functions in optinum:: namespace"})
 
@@ -164,6 +171,13 @@ if has_config("tests") then
     end
 end
 
+local BENCH_DEP_NAMES = {unpack(LIB_DEP_NAMES)}
+if has_config("benchmarks") then
+    for _, dep in ipairs(BENCH_DEPS) do
+        table.insert(BENCH_DEP_NAMES, process_dep(dep))
+    end
+end
+
 -- Main library
 target(PROJECT_NAME)
     set_kind("static")
@@ -174,6 +188,14 @@ target(PROJECT_NAME)
 
     for _, dep in ipairs(LIB_DEP_NAMES) do add_packages(dep) end
 
+    -- ParallelGrid / WorkStealingPool use std::thread
+    if is_plat("linux", "macosx") then
+        add_syslinks("pthread", {public = true})
+    end
+
+    -- Consumers compile the header-side noise code too; keep it contraction-free like the library
+    add_cxxflags("-ffp-contract=off", {public = true})
+
     if has_config("short_namespace") then
         add_defines("SHORT_NAMESPACE", {public = true})
     end
@@ -214,7 +236,7 @@ local function add_binaries(pattern, opts)
     end
 end
 
--- Examples & Tests (only when this is the main project)
+-- Examples, Tests & Benchmarks (only when this is the main project)
 if os.projectdir() == os.curdir() then
     if has_config("examples") then
         add_binaries("examples/*.cpp", {
@@ -231,4 +253,11 @@ if os.projectdir() == os.curdir() then
             is_test = true
         })
     end
+
+    if has_config("benchmarks") then
+        add_binaries("bench/*.cpp", {
+            packages = BENCH_DEP_NAMES,
+            syslinks = {"pthread"}
+        })
+    end
 end